@@ -0,0 +1,40 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "allocations.hpp"
+
+namespace {
+
+std::atomic<uint64_t> allocation_count{0};
+
+}  // namespace
+
+uint64_t
+GetAllocationCount() noexcept {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+// The array and nothrow forms forward here, so this covers every unaligned
+// allocation including those made by std::vector.
+void*
+operator new(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void* memory = std::malloc(size == 0 ? 1 : size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void
+operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void
+operator delete(void* memory, size_t /*size*/) noexcept {
+  std::free(memory);
+}
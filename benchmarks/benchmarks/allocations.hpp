@@ -0,0 +1,7 @@
+#pragma once
+
+#include <cstdint>
+
+// Number of global operator new calls so far, across all threads.
+uint64_t
+GetAllocationCount() noexcept;
@@ -0,0 +1,95 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "big_float.hpp"
+#include "exponent.hpp"
+#include "operands.hpp"
+#include "sign.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Exponent;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::Mul;
+using big_float::Sign;
+using big_float::Sub;
+using operands::GetLimbCounts;
+using operands::Kind;
+using operands::MakeFinite;
+using operands::MakeOperand;
+using operands::Measure;
+
+namespace {
+
+using Arithmetic = BigFloat (*)(const BigFloat&, const BigFloat&) noexcept;
+
+constexpr int64_t kGaps[] = {0, 1, 64, 4096};
+
+void
+AddAlignedArguments(benchmark::internal::Benchmark* benchmark) noexcept {
+  benchmark->ArgNames({"limbs", "gap", "mixed"});
+  for (const int64_t kLimbs : GetLimbCounts()) {
+    for (const int64_t kGap : kGaps) {
+      benchmark->Args({kLimbs, kGap, 0});
+      benchmark->Args({kLimbs, kGap, 1});
+    }
+  }
+}
+
+void
+AddProductArguments(benchmark::internal::Benchmark* benchmark) noexcept {
+  benchmark->ArgNames({"limbs", "mixed"});
+  for (const int64_t kLimbs : GetLimbCounts()) {
+    benchmark->Args({kLimbs, 0});
+    benchmark->Args({kLimbs, 1});
+  }
+}
+
+// The addend sits `gap` limbs below the augend, so the result spans
+// limbs + gap limbs; mixed signs turn Add into a subtraction and back.
+void
+Aligned(benchmark::State& state, Arithmetic operation) noexcept {
+  const auto kLimbs = static_cast<size_t>(state.range(0));
+  const Exponent kGap = state.range(1);
+  const Sign kSign = state.range(2) != 0 ? GetNegative() : GetPositive();
+  const BigFloat kLhs = MakeFinite(kLimbs);
+  const BigFloat kRhs = MakeFinite(kLimbs, -kGap, kSign);
+
+  Measure(state, operation, kLhs, kRhs, 2 * kLimbs);
+}
+
+void
+Product(benchmark::State& state, Arithmetic operation) noexcept {
+  const auto kLimbs = static_cast<size_t>(state.range(0));
+  const Sign kSign = state.range(1) != 0 ? GetNegative() : GetPositive();
+  const BigFloat kLhs = MakeFinite(kLimbs);
+  const BigFloat kRhs = MakeFinite(kLimbs, 0, kSign);
+
+  Measure(state, operation, kLhs, kRhs, 2 * kLimbs);
+}
+
+void
+Special(benchmark::State& state, Arithmetic operation) noexcept {
+  const BigFloat kLhs = MakeOperand(static_cast<Kind>(state.range(0)));
+  const BigFloat kRhs = MakeOperand(static_cast<Kind>(state.range(1)));
+
+  Measure(state, operation, kLhs, kRhs, 2);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(Aligned, Add, Arithmetic{Add})->Apply(AddAlignedArguments);
+BENCHMARK_CAPTURE(Aligned, Sub, Arithmetic{Sub})->Apply(AddAlignedArguments);
+BENCHMARK_CAPTURE(Product, Mul, Arithmetic{Mul})
+    ->Apply(AddProductArguments)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(Special, Add, Arithmetic{Add})
+    ->Apply(operands::AddSpecialArguments);
+BENCHMARK_CAPTURE(Special, Sub, Arithmetic{Sub})
+    ->Apply(operands::AddSpecialArguments);
+BENCHMARK_CAPTURE(Special, Mul, Arithmetic{Mul})
+    ->Apply(operands::AddSpecialArguments);
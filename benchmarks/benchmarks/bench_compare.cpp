@@ -0,0 +1,78 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "big_float.hpp"
+#include "exponent.hpp"
+#include "operands.hpp"
+#include "sign.hpp"
+
+using big_float::BigFloat;
+using big_float::Exponent;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsGreater;
+using big_float::IsLower;
+using big_float::Sign;
+using operands::GetLimbCounts;
+using operands::Kind;
+using operands::MakeFinite;
+using operands::MakeOperand;
+using operands::Measure;
+
+namespace {
+
+using Comparison = bool (*)(const BigFloat&, const BigFloat&) noexcept;
+
+constexpr int64_t kGaps[] = {0, 1, 4096};
+
+void
+AddCompareArguments(benchmark::internal::Benchmark* benchmark) noexcept {
+  benchmark->ArgNames({"limbs", "gap", "mixed"});
+  for (const int64_t kLimbs : GetLimbCounts()) {
+    for (const int64_t kGap : kGaps) {
+      benchmark->Args({kLimbs, kGap, 0});
+      benchmark->Args({kLimbs, kGap, 1});
+    }
+  }
+}
+
+// Without a gap the operands differ only in their lowest limb, which forces
+// a full scan; a gap or mixed signs should decide in constant time.
+void
+Finite(benchmark::State& state, Comparison comparison) noexcept {
+  const auto kLimbs = static_cast<size_t>(state.range(0));
+  const Exponent kGap = state.range(1);
+  const Sign kSign = state.range(2) != 0 ? GetNegative() : GetPositive();
+  const BigFloat kLhs = MakeFinite(kLimbs);
+  BigFloat rhs = MakeFinite(kLimbs, -kGap, kSign);
+  ++rhs.number.limbs.front();
+
+  Measure(state, comparison, kLhs, rhs, 2 * kLimbs);
+}
+
+void
+Special(benchmark::State& state, Comparison comparison) noexcept {
+  const BigFloat kLhs = MakeOperand(static_cast<Kind>(state.range(0)));
+  const BigFloat kRhs = MakeOperand(static_cast<Kind>(state.range(1)));
+
+  Measure(state, comparison, kLhs, kRhs, 2);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(Finite, IsEqual, Comparison{IsEqual})
+    ->Apply(AddCompareArguments);
+BENCHMARK_CAPTURE(Finite, IsGreater, Comparison{IsGreater})
+    ->Apply(AddCompareArguments);
+BENCHMARK_CAPTURE(Finite, IsLower, Comparison{IsLower})
+    ->Apply(AddCompareArguments);
+
+BENCHMARK_CAPTURE(Special, IsEqual, Comparison{IsEqual})
+    ->Apply(operands::AddSpecialArguments);
+BENCHMARK_CAPTURE(Special, IsGreater, Comparison{IsGreater})
+    ->Apply(operands::AddSpecialArguments);
+BENCHMARK_CAPTURE(Special, IsLower, Comparison{IsLower})
+    ->Apply(operands::AddSpecialArguments);
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "allocations.hpp"
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace operands {
+
+constexpr uint64_t kLimbPattern = 0x9E3779B97F4A7C15;
+constexpr int64_t kMaxLimbs = int64_t{1} << 20;
+constexpr int64_t kLimbStep = 8;
+constexpr int64_t kSpecialLimbs = 16;
+
+enum class Kind : int64_t { kFinite, kZero, kInf, kNegativeInf, kNan };
+
+constexpr int64_t kKinds = static_cast<int64_t>(Kind::kNan) + 1;
+
+inline big_float::BigFloat
+MakeFinite(size_t limbs, big_float::Exponent exp = 0,
+           big_float::Sign sign = big_float::GetPositive()) noexcept {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::vector<uint64_t>(limbs, kLimbPattern);
+  return big_float::MakeBigFloat(std::move(mantissa), exp, sign,
+                                 big_float::Type::kDefault,
+                                 big_float::GetDefaultError());
+}
+
+inline big_float::BigFloat
+MakeOperand(Kind kind) noexcept {
+  switch (kind) {
+    case Kind::kZero:
+      return big_float::MakeZero();
+    case Kind::kInf:
+      return big_float::MakeInf();
+    case Kind::kNegativeInf:
+      return big_float::MakeInf(big_float::GetNegative());
+    case Kind::kNan:
+      return big_float::MakeNan();
+    case Kind::kFinite:
+      break;
+  }
+  return MakeFinite(kSpecialLimbs);
+}
+
+// 1, 8, 64, ... limbs up to about a million.
+inline std::vector<int64_t>
+GetLimbCounts() noexcept {
+  std::vector<int64_t> counts;
+  for (int64_t limbs = 1; limbs < kMaxLimbs; limbs *= kLimbStep) {
+    counts.push_back(limbs);
+  }
+  counts.push_back(kMaxLimbs);
+  return counts;
+}
+
+inline void
+AddSpecialArguments(benchmark::internal::Benchmark* benchmark) noexcept {
+  benchmark->ArgNames({"lhs", "rhs"});
+  for (int64_t lhs = 0; lhs < kKinds; ++lhs) {
+    for (int64_t rhs = 0; rhs < kKinds; ++rhs) {
+      benchmark->Args({lhs, rhs});
+    }
+  }
+}
+
+// Runs `operation` over the fixed operands and reports the limbs read per
+// second and the heap allocations per call.
+template <typename Operation>
+void
+Measure(benchmark::State& state, Operation operation,
+        const big_float::BigFloat& lhs, const big_float::BigFloat& rhs,
+        size_t limbs) noexcept {
+  const uint64_t kBefore = GetAllocationCount();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(operation(lhs, rhs));
+  }
+  const uint64_t kAllocations = GetAllocationCount() - kBefore;
+  const double kLimbs =
+      static_cast<double>(state.iterations()) * static_cast<double>(limbs);
+
+  state.SetBytesProcessed(static_cast<int64_t>(kLimbs * sizeof(uint64_t)));
+  state.counters["limbs/s"] =
+      benchmark::Counter(kLimbs, benchmark::Counter::kIsRate);
+  state.counters["allocs/op"] =
+      benchmark::Counter(static_cast<double>(kAllocations),
+                         benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace operands
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+
+// Exact running sum in a redundant fixed-point form: limb i of the value is
+// limbs[i] + carries[i], with carries[i] counting the unresolved carries
+// (or borrows) out of limb i - 1. Adding a term only touches the limbs it
+// covers; carries are resolved when a BigFloat is requested. `type` stays
+// kDefault until an infinite or NaN term arrives.
+struct BigFloatAccumulator {  // NOLINT
+  std::vector<uint64_t> limbs;
+  std::vector<int64_t> carries;
+  Exponent exp;
+  Type type;
+  Sign sign;
+};
+
+BigFloatAccumulator
+MakeAccumulator() noexcept;
+
+void
+Add(BigFloatAccumulator& accumulator, const BigFloatView& addend) noexcept;
+
+void
+Add(BigFloatAccumulator& accumulator, const BigFloat& addend) noexcept;
+
+void
+Sub(BigFloatAccumulator& accumulator, const BigFloatView& subtrahend) noexcept;
+
+void
+Sub(BigFloatAccumulator& accumulator, const BigFloat& subtrahend) noexcept;
+
+// Exact sum; +0 when the finite terms cancel.
+BigFloat
+ToBigFloat(const BigFloatAccumulator& accumulator) noexcept;
+
+BigFloat
+Truncate(const BigFloatAccumulator& accumulator, Precision precision) noexcept;
+
+}  // namespace big_float
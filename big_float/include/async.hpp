@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+
+#include "big_float.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+// Copies of a token share one flag, so any of them can cancel the call.
+struct CancelToken {  // NOLINT
+  std::shared_ptr<std::atomic<bool>> is_cancelled;
+};
+
+CancelToken
+MakeCancelToken() noexcept;
+
+void
+Cancel(const CancelToken& token) noexcept;
+
+bool
+IsCancelled(const CancelToken& token) noexcept;
+
+using Deadline = std::chrono::steady_clock::time_point;
+
+// Completed and total work units of the call. Forked work may report from
+// several threads at once; the callback runs a bounded number of times.
+using Progress = std::function<void(uint64_t done, uint64_t total)>;
+
+// All fields are optional: a default token is never cancelled.
+struct AsyncOptions {  // NOLINT
+  CancelToken token;
+  std::optional<Deadline> deadline;
+  Progress progress;
+};
+
+// Heavy operations run on the executor. When its concurrency is 1, i.e. it
+// runs tasks inline, each call starts one detached thread instead, so the
+// future always returns before the work is done. The token and the
+// deadline are checked between multiplication blocks; a call that stops
+// early yields NaN with ErrorCode::kCancelled or
+// ErrorCode::kDeadlineExceeded.
+std::future<BigFloat>
+DivAsync(BigFloat dividend, BigFloat divisor, Precision precision,
+         AsyncOptions options = {}) noexcept;
+
+std::future<BigFloat>
+ExpAsync(BigFloat exponent, Precision precision,
+         AsyncOptions options = {}) noexcept;
+
+std::future<BigFloat>
+ComputePiAsync(Precision precision, AsyncOptions options = {}) noexcept;
+
+}  // namespace big_float
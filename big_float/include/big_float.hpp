@@ -1,23 +1,55 @@
 #pragma once
 
+#include <concepts>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <type_traits>
 
 #include "big_uint.hpp"
 #include "error.hpp"
 #include "exponent.hpp"
+#include "precision.hpp"
 #include "sign.hpp"
 #include "type.hpp"
 
 namespace big_float {
 
+// Type (bits 0-1), sign (bit 2) and error code (bits 3-7) of a number.
+using Header = uint8_t;
+
+// The limb exponent shares one word with the header byte: the header is the
+// low byte and the exponent the upper 56 bits, so a BigFloat is the mantissa
+// plus eight bytes and two of them fit in a cache line.
 struct BigFloat {  // NOLINT
   big_uint::BigUInt number;
-  Exponent exp;
-  Type type;
-  Sign sign;
-  Error error;
+  uint64_t exp_and_header;
 };
 
+static_assert(sizeof(BigFloat) == 32);
+
+constexpr int kHeaderBits = 8;
+constexpr Header kHeaderMask = 0xFF;
+constexpr Header kTypeMask = 0x03;
+constexpr Header kSignMask = 0x04;
+constexpr int kErrorShift = 3;
+
+// Every error code must fit the bits above the type and sign, or packing it
+// would overwrite them.
+static_assert(static_cast<int>(ErrorCode::kCount) <=
+              1 << (kHeaderBits - kErrorShift));
+
+// Limb exponents that fit the 56 bits above the header. MakeBigFloat turns a
+// finite number whose exponent lies above this range into an infinity and
+// one below it into a zero, keeping the sign and error.
+constexpr Exponent kMaxExponent = (Exponent{1} << (63 - kHeaderBits)) - 1;
+constexpr Exponent kMinExponent = -kMaxExponent - 1;
+
+inline constexpr Header
+GetHeader(const BigFloat& number) noexcept {
+  return static_cast<Header>(number.exp_and_header & kHeaderMask);
+}
+
 BigFloat
 MakeBigFloat(big_uint::BigUInt number, Exponent exp, Sign sign, Type type,
              Error error) noexcept;
@@ -34,17 +66,30 @@ BigFloat
 MakeNan(Sign sign = GetPositive(),
         const Error& error = GetDefaultError()) noexcept;
 
-bool
-IsZero(const BigFloat& number) noexcept;
+inline constexpr bool
+IsZero(const BigFloat& number) noexcept {
+  return (GetHeader(number) & kTypeMask) == static_cast<Header>(Type::kZero);
+}
 
-bool
-IsInf(const BigFloat& number) noexcept;
+inline constexpr bool
+IsInf(const BigFloat& number) noexcept {
+  return (GetHeader(number) & kTypeMask) == static_cast<Header>(Type::kInf);
+}
 
-bool
-IsNan(const BigFloat& number) noexcept;
+inline constexpr bool
+IsNan(const BigFloat& number) noexcept {
+  return (GetHeader(number) & kTypeMask) == static_cast<Header>(Type::kNan);
+}
 
-const Error&
-GetError(const BigFloat& number) noexcept;
+inline constexpr Sign
+GetSign(const BigFloat& number) noexcept {
+  return (GetHeader(number) & kSignMask) != 0 ? GetNegative() : GetPositive();
+}
+
+inline constexpr Error
+GetError(const BigFloat& number) noexcept {
+  return MakeError(static_cast<ErrorCode>(GetHeader(number) >> kErrorShift));
+}
 
 std::string
 ToString(const BigFloat& number) noexcept;
@@ -58,12 +103,20 @@ IsGreater(const BigFloat& left, const BigFloat& right) noexcept;
 bool
 IsLower(const BigFloat& left, const BigFloat& right) noexcept;
 
+// The rvalue overloads flip the sign in place instead of copying the
+// mantissa.
 BigFloat
 Abs(const BigFloat& number) noexcept;
 
+BigFloat
+Abs(BigFloat&& number) noexcept;
+
 BigFloat
 Neg(const BigFloat& number) noexcept;
 
+BigFloat
+Neg(BigFloat&& number) noexcept;
+
 BigFloat
 Add(const BigFloat& augend, const BigFloat& addend) noexcept;
 
@@ -73,10 +126,149 @@ Sub(const BigFloat& minuend, const BigFloat& subtrahend) noexcept;
 BigFloat
 Mul(const BigFloat& multiplicand, const BigFloat& multiplier) noexcept;
 
+// x * x with each cross product of limbs formed once; Mul(x, x) on the same
+// object is routed here.
+BigFloat
+Sqr(const BigFloat& operand) noexcept;
+
 BigFloat
 Div(const BigFloat& dividend, const BigFloat& divisor) noexcept;
 
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor,
+    Precision precision) noexcept;
+
+// Mixed operands: integers go through single-limb kernels and a double is
+// read as its exact 53-bit mantissa times a power of two, so no BigFloat is
+// built for the machine operand. Other integer types, plain int literals
+// included, go through the int64_t or uint64_t overload by signedness.
+BigFloat
+Add(const BigFloat& augend, int64_t addend) noexcept;
+
+BigFloat
+Add(const BigFloat& augend, uint64_t addend) noexcept;
+
+BigFloat
+Add(const BigFloat& augend, double addend) noexcept;
+
+BigFloat
+Sub(const BigFloat& minuend, int64_t subtrahend) noexcept;
+
+BigFloat
+Sub(const BigFloat& minuend, uint64_t subtrahend) noexcept;
+
+BigFloat
+Sub(const BigFloat& minuend, double subtrahend) noexcept;
+
+BigFloat
+Mul(const BigFloat& multiplicand, int64_t multiplier) noexcept;
+
+BigFloat
+Mul(const BigFloat& multiplicand, uint64_t multiplier) noexcept;
+
+BigFloat
+Mul(const BigFloat& multiplicand, double multiplier) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, int64_t divisor) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, uint64_t divisor) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, double divisor) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, int64_t divisor, Precision precision) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, uint64_t divisor, Precision precision) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, double divisor, Precision precision) noexcept;
+
+template <std::integral Integer>
+inline constexpr auto
+WidenInteger(Integer value) noexcept {
+  if constexpr (std::is_signed_v<Integer>) {
+    return static_cast<int64_t>(value);
+  } else {
+    return static_cast<uint64_t>(value);
+  }
+}
+
+template <std::integral Integer>
+inline BigFloat
+Add(const BigFloat& augend, Integer addend) noexcept {
+  return Add(augend, WidenInteger(addend));
+}
+
+template <std::integral Integer>
+inline BigFloat
+Sub(const BigFloat& minuend, Integer subtrahend) noexcept {
+  return Sub(minuend, WidenInteger(subtrahend));
+}
+
+template <std::integral Integer>
+inline BigFloat
+Mul(const BigFloat& multiplicand, Integer multiplier) noexcept {
+  return Mul(multiplicand, WidenInteger(multiplier));
+}
+
+template <std::integral Integer>
+inline BigFloat
+Div(const BigFloat& dividend, Integer divisor) noexcept {
+  return Div(dividend, WidenInteger(divisor));
+}
+
+template <std::integral Integer>
+inline BigFloat
+Div(const BigFloat& dividend, Integer divisor, Precision precision) noexcept {
+  return Div(dividend, WidenInteger(divisor), precision);
+}
+
 BigFloat
 Sqrt(const BigFloat& operand) noexcept;
 
+BigFloat
+Sqrt(const BigFloat& operand, Precision precision) noexcept;
+
+// x^n by binary exponentiation; a negative n inverts the result.
+BigFloat
+PowInt(const BigFloat& base, int64_t power, Precision precision) noexcept;
+
+// Real n-th root; NaN for even n and a negative operand.
+BigFloat
+NthRoot(const BigFloat& operand, uint64_t degree,
+        Precision precision) noexcept;
+
+BigFloat
+Truncate(const BigFloat& number, Precision precision) noexcept;
+
+// Exact number * 2^bit_exponent. Shifts by whole limbs only move the
+// exponent, so the rvalue overload is O(1) for multiples of 64.
+BigFloat
+Ldexp(const BigFloat& number, int64_t bit_exponent) noexcept;
+
+BigFloat
+Ldexp(BigFloat&& number, int64_t bit_exponent) noexcept;
+
+// number = fraction * 2^exponent with 0.5 <= |fraction| < 1; special values
+// come back unchanged with a zero exponent.
+struct Decomposition {  // NOLINT
+  BigFloat fraction;
+  int64_t exponent;
+};
+
+Decomposition
+Frexp(const BigFloat& number) noexcept;
+
+constexpr int64_t kIlogbZero = std::numeric_limits<int64_t>::min();
+constexpr int64_t kIlogbNan = std::numeric_limits<int64_t>::min();
+constexpr int64_t kIlogbInf = std::numeric_limits<int64_t>::max();
+
+// floor(log2 |number|), exact to the bit.
+int64_t
+Ilogb(const BigFloat& number) noexcept;
+
 }  // namespace big_float
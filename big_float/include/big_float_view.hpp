@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "big_float.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+
+// Non-owning counterpart of BigFloat: the limbs are borrowed from storage that
+// must outlive the view (a BigFloat, a mapped column file, ...).
+struct BigFloatView {  // NOLINT
+  std::span<const uint64_t> limbs;
+  Exponent exp;
+  Type type;
+  Sign sign;
+  Error error;
+};
+
+BigFloatView
+MakeView(const BigFloat& number) noexcept;
+
+BigFloatView
+MakeView(std::span<const uint64_t> limbs, Exponent exp, Sign sign, Type type,
+         Error error) noexcept;
+
+BigFloat
+ToBigFloat(const BigFloatView& view) noexcept;
+
+// Copies only the limbs that survive the truncation.
+BigFloat
+Truncate(const BigFloatView& view, Precision precision) noexcept;
+
+bool
+IsEqual(const BigFloatView& left, const BigFloatView& right) noexcept;
+
+bool
+IsGreater(const BigFloatView& left, const BigFloatView& right) noexcept;
+
+bool
+IsLower(const BigFloatView& left, const BigFloatView& right) noexcept;
+
+BigFloatView
+Abs(const BigFloatView& view) noexcept;
+
+BigFloatView
+Neg(const BigFloatView& view) noexcept;
+
+BigFloat
+Add(const BigFloatView& augend, const BigFloatView& addend) noexcept;
+
+BigFloat
+Sub(const BigFloatView& minuend, const BigFloatView& subtrahend) noexcept;
+
+BigFloat
+Mul(const BigFloatView& multiplicand, const BigFloatView& multiplier) noexcept;
+
+BigFloat
+Sqr(const BigFloatView& operand) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace big_float {
+
+// Largest mantissa, in bytes, that one operation on the calling thread may
+// allocate for its result; zero, the default, means unlimited. Operations
+// whose projected result is larger return NaN with
+// ErrorCode::kMemoryBudgetExceeded instead of allocating. Work forked onto
+// the executor runs under the budget of the thread that forked it.
+void
+SetMemoryBudget(size_t bytes) noexcept;
+
+size_t
+GetMemoryBudget() noexcept;
+
+bool
+FitsMemoryBudget(uint64_t limbs) noexcept;
+
+}  // namespace big_float
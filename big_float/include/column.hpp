@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "error.hpp"
+
+namespace big_float {
+
+// On-disk layout (native byte order): a 32-byte header, `count` fixed-size
+// 32-byte entries {exp, type, sign, error, offset, length} and a packed arena
+// of 64-bit limbs. Entry `offset` and `length` are counted in limbs.
+
+enum class ColumnAccess : uint8_t { kRandom = 0, kSequential = 1 };
+
+constexpr size_t kDefaultProductBlockLimbs = size_t{1} << 22;
+
+struct Column {  // NOLINT
+  std::shared_ptr<const std::byte> data;
+  size_t size;
+  size_t count;
+  Error error;
+};
+
+Error
+WriteColumn(const std::string& path,
+            std::span<const BigFloat> numbers) noexcept;
+
+Column
+OpenColumn(const std::string& path,
+           ColumnAccess access = ColumnAccess::kRandom) noexcept;
+
+const Error&
+GetError(const Column& column) noexcept;
+
+size_t
+GetCount(const Column& column) noexcept;
+
+BigFloatView
+GetView(const Column& column, size_t index) noexcept;
+
+// Writes lhs * rhs to `path` as a one-entry column without holding either
+// operand or the product in memory, e.g. for views into columns opened with
+// ColumnAccess::kSequential. The operands are cut into `block_limbs`-limb
+// blocks; the block products of one anti-diagonal are summed into a window
+// of two blocks, whose finished low block is appended to the file. Memory
+// stays at a few blocks and the file is written front to back.
+//
+// The outer loop is block schoolbook: operands of n limbs take (n / B)^2
+// in-memory block products for B = `block_limbs`, and every block of one
+// operand is read again for each block of the other. At the default block
+// size that is practical up to a few tens of millions of limbs (hundreds of
+// MiB per operand); it is not an out-of-core multiplier for operands larger
+// than RAM, whose cost would grow quadratically in the block count.
+Error
+WriteProduct(const std::string& path, const BigFloatView& lhs,
+             const BigFloatView& rhs,
+             size_t block_limbs = kDefaultProductBlockLimbs) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "big_float.hpp"
+#include "executor.hpp"
+#include "precision.hpp"
+#include "shared.hpp"
+
+namespace big_float {
+
+enum class Constant { kPi, kE, kLn2, kLn10 };
+
+BigFloat
+ComputePi(Precision precision) noexcept;
+
+// Binary splitting forks on `parallelism`, which counts series terms.
+BigFloat
+ComputePi(Precision precision, const Parallelism& parallelism) noexcept;
+
+BigFloat
+ComputeE(Precision precision) noexcept;
+
+BigFloat
+ComputeLn2(Precision precision) noexcept;
+
+BigFloat
+ComputeLn10(Precision precision) noexcept;
+
+// Cached value of `constant` truncated to `precision` bits. A request above
+// the cached precision recomputes once; concurrent callers wait for it.
+BigFloat
+GetConstant(Constant constant, Precision precision) noexcept;
+
+// Shared handle to the cached value, which has at least `precision` bits:
+// O(1) once the cache is warm.
+SharedBigFloat
+GetSharedConstant(Constant constant, Precision precision) noexcept;
+
+}  // namespace big_float
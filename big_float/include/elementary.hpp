@@ -0,0 +1,56 @@
+#pragma once
+
+#include "big_float.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+struct SineCosine {  // NOLINT
+  BigFloat sin;
+  BigFloat cos;
+};
+
+BigFloat
+Exp(const BigFloat& exponent, Precision precision) noexcept;
+
+// Exp(x) - 1 without cancellation for small x.
+BigFloat
+Expm1(const BigFloat& exponent, Precision precision) noexcept;
+
+BigFloat
+Log(const BigFloat& operand, Precision precision) noexcept;
+
+// Exact for powers of two.
+BigFloat
+Log2(const BigFloat& operand, Precision precision) noexcept;
+
+// Log(1 + x) without cancellation for small x.
+BigFloat
+Log1p(const BigFloat& operand, Precision precision) noexcept;
+
+// x^y with IEEE 754 special cases; integer y goes through PowInt.
+BigFloat
+Pow(const BigFloat& base, const BigFloat& exponent,
+    Precision precision) noexcept;
+
+BigFloat
+Sin(const BigFloat& angle, Precision precision) noexcept;
+
+BigFloat
+Cos(const BigFloat& angle, Precision precision) noexcept;
+
+// Both values from one argument reduction and one series evaluation.
+SineCosine
+SinCos(const BigFloat& angle, Precision precision) noexcept;
+
+BigFloat
+Tan(const BigFloat& angle, Precision precision) noexcept;
+
+BigFloat
+Atan(const BigFloat& operand, Precision precision) noexcept;
+
+// Angle of the point (x, y) in [-pi, pi], with IEEE 754 signed-zero rules.
+BigFloat
+Atan2(const BigFloat& y, const BigFloat& x, Precision precision) noexcept;
+
+}  // namespace big_float
@@ -6,21 +6,44 @@ namespace big_float {
 enum class ErrorCode : uint8_t {
   kOk,
   kError,
+  kIoError,
+  kInvalidFormat,
+  kChecksumMismatch,
+  kCancelled,
+  kDeadlineExceeded,
+  kMemoryBudgetExceeded,
+  kRoundingUnproven,
+  // Number of codes above; not a code itself.
+  kCount,
 };
 
 struct Error {
   ErrorCode code;
 };
 
-Error
-MakeError(ErrorCode code) noexcept;
+inline constexpr Error
+MakeError(ErrorCode code) noexcept {
+  return Error{code};
+}
 
-const ErrorCode&
-GetErrorCode(const Error& error) noexcept;
+inline constexpr const ErrorCode&
+GetErrorCode(const Error& error) noexcept {
+  return error.code;
+}
 
-bool
-IsOk(const Error& error) noexcept;
+inline constexpr bool
+IsOk(const Error& error) noexcept {
+  return GetErrorCode(error) == ErrorCode::kOk;
+}
 
-Error
-GetDefaultError() noexcept;
+inline constexpr Error
+GetDefaultError() noexcept {
+  return MakeError(ErrorCode::kOk);
+}
+
+// Whether a byte read from storage names an ErrorCode.
+inline constexpr bool
+IsErrorCode(uint8_t code) noexcept {
+  return code < static_cast<uint8_t>(ErrorCode::kCount);
+}
 }  // namespace big_float
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace big_float {
+
+using Task = std::function<void()>;
+
+// Where the library runs parallel work. `submit` must eventually run every
+// task it accepts, on any thread. `concurrency` is the number of threads
+// the library may keep busy at once, the calling thread included.
+struct Executor {  // NOLINT
+  std::function<void(Task)> submit;
+  size_t concurrency;
+};
+
+// Work-stealing pool: every worker pops its own queue from the back and
+// steals from the front of the others. The workers finish the queued tasks
+// and are joined when the last copy of the executor goes away, from a
+// separate thread if that happens on one of the workers.
+Executor
+MakeThreadPool(size_t threads) noexcept;
+
+// Installs the executor for all later parallel calls, e.g. the
+// application's own scheduler, so that the library adds no threads of its
+// own; only async calls on an inline executor (concurrency 1) start one
+// each. Until then a pool of hardware_concurrency() - 1 workers is started
+// on first use.
+void
+SetExecutor(Executor executor) noexcept;
+
+std::shared_ptr<const Executor>
+GetExecutor() noexcept;
+
+// Per-call limits: work forks at most `depth` levels below the call and
+// never into pieces smaller than `grain` units, where the unit (terms,
+// limbs, ...) is up to the caller.
+struct Parallelism {  // NOLINT
+  std::shared_ptr<const Executor> executor;
+  int depth;
+  uint64_t grain;
+};
+
+// Enough depth to occupy the current executor: log2 of its concurrency.
+Parallelism
+MakeParallelism(uint64_t grain) noexcept;
+
+Parallelism
+MakeParallelism(int depth, uint64_t grain) noexcept;
+
+// One level further down, for the work inside a forked task.
+Parallelism
+Descend(const Parallelism& parallelism) noexcept;
+
+// Runs both tasks and returns when both are done. With depth left and at
+// least `grain` units of work, `left` goes to the executor while the caller
+// runs `right`; if no thread has picked `left` up by then, the caller runs
+// it too, so a saturated executor never blocks the join.
+void
+ForkJoin(const Parallelism& parallelism, uint64_t size, const Task& left,
+         const Task& right) noexcept;
+
+}  // namespace big_float
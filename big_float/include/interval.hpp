@@ -0,0 +1,65 @@
+#pragma once
+
+#include "big_float.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+// Closed interval [lower, upper]. Operations round the lower bound toward
+// -inf and the upper bound toward +inf, so the exact result of applying
+// the operation to any members of the operands is always enclosed.
+struct BigInterval {  // NOLINT
+  BigFloat lower;
+  BigFloat upper;
+};
+
+BigInterval
+MakeInterval(const BigFloat& point) noexcept;
+
+BigInterval
+MakeInterval(const BigFloat& lower, const BigFloat& upper) noexcept;
+
+bool
+IsPoint(const BigInterval& interval) noexcept;
+
+bool
+Contains(const BigInterval& interval, const BigFloat& value) noexcept;
+
+// Exact upper - lower.
+BigFloat
+GetWidth(const BigInterval& interval) noexcept;
+
+// Every member of `left` is lower than every member of `right`.
+bool
+IsCertainlyLower(const BigInterval& left, const BigInterval& right) noexcept;
+
+bool
+IsCertainlyGreater(const BigInterval& left, const BigInterval& right) noexcept;
+
+// The intervals share at least one member.
+bool
+IsPossiblyEqual(const BigInterval& left, const BigInterval& right) noexcept;
+
+BigInterval
+Add(const BigInterval& augend, const BigInterval& addend,
+    Precision precision) noexcept;
+
+BigInterval
+Sub(const BigInterval& minuend, const BigInterval& subtrahend,
+    Precision precision) noexcept;
+
+BigInterval
+Mul(const BigInterval& multiplicand, const BigInterval& multiplier,
+    Precision precision) noexcept;
+
+// [-inf, +inf] when `divisor` contains zero.
+BigInterval
+Div(const BigInterval& dividend, const BigInterval& divisor,
+    Precision precision) noexcept;
+
+// Negative members are ignored; NaN bounds when no member is
+// non-negative.
+BigInterval
+Sqrt(const BigInterval& operand, Precision precision) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace big_float {
+
+// Number of significant mantissa bits requested from inexact operations.
+using Precision = uint64_t;
+
+}  // namespace big_float
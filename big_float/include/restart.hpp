@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "async.hpp"
+#include "big_float.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+// Where and how often a long computation saves its state. Every save
+// replaces `path` atomically, so a crash leaves the previous or the new
+// checkpoint, never a torn one. A cancelled `token` saves immediately and
+// yields NaN with ErrorCode::kCancelled: the hook for preemption notices.
+// The file is removed once the result is ready; failed saves and unreadable
+// or mismatched checkpoints yield NaN with the I/O or format error.
+struct RestartOptions {  // NOLINT
+  std::string path;
+  std::chrono::steady_clock::duration interval;
+  CancelToken token;
+};
+
+// Saves the stack of finished binary-splitting nodes between blocks of
+// terms; the result equals ComputePi(precision).
+BigFloat
+ComputePi(Precision precision, const RestartOptions& options) noexcept;
+
+// Continues from options.path with the precision stored there.
+BigFloat
+ResumePi(const RestartOptions& options) noexcept;
+
+// Saves the reciprocal after each Newton step. Divisions that do not take
+// the Newton path finish without touching the file.
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor, Precision precision,
+    const RestartOptions& options) noexcept;
+
+// The operands must be the ones of the interrupted call; the divisor is
+// checked against the checkpoint.
+BigFloat
+ResumeDiv(const BigFloat& dividend, const BigFloat& divisor,
+          const RestartOptions& options) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <utility>
+
+#include "big_float.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+// Guard bits of the first attempt of `EvaluateRounded`.
+constexpr Precision kZivGuardBits = 32;
+// The working precision doubles between attempts, so the last one runs at
+// 4x the first.
+constexpr int kZivMaxAttempts = 3;
+
+// What `function` may return to `EvaluateRounded` instead of a bare
+// BigFloat when it can tell that `value` is exact, for example an integer
+// square root or a sum without carries past the working precision.
+struct ZivApproximation {  // NOLINT
+  BigFloat value;
+  bool is_exact;
+};
+
+// Whether every value within 4 ulps (at `working` bits) of `approximation`
+// truncates to the same `precision`-bit result.
+bool
+IsRoundable(const BigFloat& approximation, Precision working,
+            Precision precision) noexcept;
+
+// Truncates `approximation` to `precision`; an unproven result carries
+// ErrorCode::kRoundingUnproven.
+BigFloat
+FinishRounded(BigFloat approximation, Precision precision,
+              bool is_proven) noexcept;
+
+inline ZivApproximation
+ToZivApproximation(BigFloat value) noexcept {
+  return {.value = std::move(value), .is_exact = false};
+}
+
+inline ZivApproximation
+ToZivApproximation(ZivApproximation approximation) noexcept {
+  return approximation;
+}
+
+// Ziv's strategy: `function(working)` must return f within 4 ulps at
+// `working` bits, either as a BigFloat or as a ZivApproximation. The first
+// attempt uses a few guard bits and the working precision doubles only
+// while the result straddles a truncation boundary. An exact result stops
+// the loop at once; one that is still not roundable after
+// `kZivMaxAttempts` evaluations is returned flagged as unproven.
+template <typename Function>
+BigFloat
+EvaluateRounded(const Function& function, Precision precision) noexcept {
+  Precision working = precision + kZivGuardBits;
+  ZivApproximation approximation = ToZivApproximation(function(working));
+  bool is_proven = approximation.is_exact ||
+                   IsRoundable(approximation.value, working, precision);
+  for (int attempt = 1; attempt < kZivMaxAttempts && !is_proven; ++attempt) {
+    working *= 2;
+    approximation = ToZivApproximation(function(working));
+    is_proven = approximation.is_exact ||
+                IsRoundable(approximation.value, working, precision);
+  }
+  return FinishRounded(std::move(approximation.value), precision, is_proven);
+}
+
+}  // namespace big_float
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+
+namespace big_float {
+
+// BigFloat with an immutable, reference-counted mantissa. Copies, Neg and
+// Abs cost O(1) and handles may be shared across threads: the header lives
+// in the handle, so sign changes never touch the shared limbs. Special
+// values hold no mantissa. Writes go only through GetMutableMantissa.
+struct SharedBigFloat {  // NOLINT
+  std::shared_ptr<const big_uint::BigUInt> mantissa;
+  uint64_t exp_and_header;
+};
+
+SharedBigFloat
+Share(BigFloat number) noexcept;
+
+// Moves the limbs out when this handle is their only owner, copies them
+// otherwise.
+BigFloat
+Unshare(SharedBigFloat number) noexcept;
+
+BigFloatView
+MakeView(const SharedBigFloat& number) noexcept;
+
+SharedBigFloat
+Neg(SharedBigFloat number) noexcept;
+
+SharedBigFloat
+Abs(SharedBigFloat number) noexcept;
+
+// Mantissa for in-place modification; copies the limbs first when another
+// handle still refers to them.
+big_uint::BigUInt&
+GetMutableMantissa(SharedBigFloat& number) noexcept;
+
+}  // namespace big_float
@@ -1,25 +1,39 @@
 #pragma once
 
+#include <cstdint>
+
 namespace big_float {
 
 using Sign = bool;
 
-Sign
-GetPositive() noexcept;
-
-Sign
-GetNegative() noexcept;
-
-bool
-IsPositive(const Sign& sign) noexcept;
-
-bool
-IsNegative(const Sign& sign) noexcept;
-
-Sign
-Invert(const Sign& sign) noexcept;
-
-bool
-IsEqual(const Sign& lhs, const Sign& rhs) noexcept;
+inline constexpr Sign
+GetPositive() noexcept {
+  return false;
+}
+
+inline constexpr Sign
+GetNegative() noexcept {
+  return true;
+}
+
+inline constexpr bool
+IsPositive(const Sign& sign) noexcept {
+  return sign == GetPositive();
+}
+
+inline constexpr bool
+IsNegative(const Sign& sign) noexcept {
+  return sign == GetNegative();
+}
+
+inline constexpr Sign
+Invert(const Sign& sign) noexcept {
+  return IsPositive(sign) ? GetNegative() : GetPositive();
+}
+
+inline constexpr bool
+IsEqual(const Sign& lhs, const Sign& rhs) noexcept {
+  return static_cast<uint8_t>(lhs) == static_cast<uint8_t>(rhs);
+}
 
 }  // namespace big_float
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+
+// Limbs exp .. exp + limbs.size() - 1 of a mantissa; the first and the last
+// limb are non-zero.
+struct LimbRun {  // NOLINT
+  Exponent exp;
+  std::vector<uint64_t> limbs;
+};
+
+// Segmented counterpart of BigFloat for values such as 2^(64 * 10^6) + 1:
+// only non-zero runs are stored, in ascending order and separated by at
+// least kSparseGap zero limbs. Add, Sub and the comparisons walk the runs
+// and never touch the gaps, unless a borrow has to cross one.
+struct SparseBigFloat {  // NOLINT
+  std::vector<LimbRun> runs;
+  Type type;
+  Sign sign;
+  Error error;
+};
+
+constexpr int64_t kSparseGap = 4;
+
+SparseBigFloat
+MakeSparse(const BigFloatView& number) noexcept;
+
+SparseBigFloat
+MakeSparse(const BigFloat& number) noexcept;
+
+// Dense form for the kernels that need one, such as multiplication.
+BigFloat
+ToBigFloat(const SparseBigFloat& number) noexcept;
+
+SparseBigFloat
+Neg(SparseBigFloat number) noexcept;
+
+SparseBigFloat
+Add(const SparseBigFloat& augend, const SparseBigFloat& addend) noexcept;
+
+SparseBigFloat
+Sub(const SparseBigFloat& minuend, const SparseBigFloat& subtrahend) noexcept;
+
+SparseBigFloat
+Mul(const SparseBigFloat& multiplicand,
+    const SparseBigFloat& multiplier) noexcept;
+
+bool
+IsEqual(const SparseBigFloat& left, const SparseBigFloat& right) noexcept;
+
+bool
+IsGreater(const SparseBigFloat& left, const SparseBigFloat& right) noexcept;
+
+bool
+IsLower(const SparseBigFloat& left, const SparseBigFloat& right) noexcept;
+
+}  // namespace big_float
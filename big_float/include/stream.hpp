@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "big_float.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+
+// Stream layout (native byte order): a header with the chunk size, then
+// chunks of at most `chunk_limbs` limbs, each preceded by {count, checksum}.
+// A zero-count chunk ends the mantissa and is followed by a trailer with the
+// exponent, type, sign, error and total limb count.
+
+constexpr size_t kDefaultChunkLimbs = size_t{1} << 16;
+
+struct StreamWriter {  // NOLINT
+  int descriptor;
+  size_t chunk_limbs;
+  std::vector<uint64_t> pending;
+  uint64_t total_limbs;
+  Error error;
+};
+
+struct StreamReader {  // NOLINT
+  int descriptor;
+  size_t chunk_limbs;
+  std::vector<uint64_t> chunk;
+  uint64_t total_limbs;
+  bool is_finished;
+  Exponent exp;
+  Type type;
+  Sign sign;
+  Error value_error;
+  Error error;
+};
+
+StreamWriter
+MakeStreamWriter(int descriptor,
+                 size_t chunk_limbs = kDefaultChunkLimbs) noexcept;
+
+const Error&
+WriteLimbs(StreamWriter& writer, std::span<const uint64_t> limbs) noexcept;
+
+const Error&
+FlushStream(StreamWriter& writer) noexcept;
+
+const Error&
+FinishStream(StreamWriter& writer, Exponent exp, Sign sign, Type type,
+             Error error) noexcept;
+
+Error
+WriteStream(int descriptor, const BigFloat& number,
+            size_t chunk_limbs = kDefaultChunkLimbs) noexcept;
+
+StreamReader
+MakeStreamReader(int descriptor) noexcept;
+
+std::span<const uint64_t>
+ReadChunk(StreamReader& reader) noexcept;
+
+BigFloat
+ReadStream(int descriptor) noexcept;
+
+}  // namespace big_float
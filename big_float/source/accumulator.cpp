@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "accumulator.hpp"
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+__extension__ using SignedWide = __int128;
+
+constexpr int kLimbShift = 64;
+
+// Makes limbs [low, high) addressable. Growing downwards moves the whole
+// window, so it grows by at least its current size.
+void
+Reserve(BigFloatAccumulator& accumulator, Exponent low,
+        Exponent high) noexcept {
+  if (accumulator.limbs.empty()) {
+    accumulator.exp = low;
+  }
+  if (low < accumulator.exp) {
+    const size_t kGrowth = std::max(
+        static_cast<size_t>(accumulator.exp - low), accumulator.limbs.size());
+    accumulator.limbs.insert(accumulator.limbs.begin(), kGrowth, 0);
+    accumulator.carries.insert(accumulator.carries.begin(), kGrowth, 0);
+    accumulator.exp -= static_cast<Exponent>(kGrowth);
+  }
+  const auto kSize = static_cast<size_t>(high - accumulator.exp);
+  if (kSize > accumulator.limbs.size()) {
+    accumulator.limbs.resize(kSize, 0);
+    accumulator.carries.resize(kSize, 0);
+  }
+}
+
+void
+AddSpecial(BigFloatAccumulator& accumulator, Type type, Sign sign) noexcept {
+  if (type == Type::kNan) {
+    accumulator.type = Type::kNan;
+  } else if (accumulator.type == Type::kDefault) {
+    accumulator.type = Type::kInf;
+    accumulator.sign = sign;
+  } else if (!IsEqual(accumulator.sign, sign)) {
+    accumulator.type = Type::kNan;
+  }
+}
+
+// The extra top limb of the reserved window receives the last carry.
+void
+AddSigned(BigFloatAccumulator& accumulator, const BigFloatView& term,
+          Sign sign) noexcept {
+  if (GetType(term) == Type::kZero || accumulator.type == Type::kNan) {
+    return;
+  }
+  if (IsSpecial(term)) {
+    AddSpecial(accumulator, GetType(term), sign);
+    return;
+  }
+  const limbs::LimbSpan kLimbs = limbs::Trim(GetLimbs(term));
+  if (kLimbs.empty() || accumulator.type != Type::kDefault) {
+    return;
+  }
+  const Exponent kLow = GetExponent(term);
+  Reserve(accumulator, kLow,
+          kLow + static_cast<Exponent>(kLimbs.size()) + 1);
+
+  const auto kOffset = static_cast<size_t>(kLow - accumulator.exp);
+  uint64_t* digits = accumulator.limbs.data() + kOffset;
+  int64_t* carries = accumulator.carries.data() + kOffset + 1;
+  if (IsNegative(sign)) {
+    for (size_t index = 0; index < kLimbs.size(); ++index) {
+      const uint64_t kDigit = digits[index];
+      digits[index] = kDigit - kLimbs[index];
+      carries[index] -= static_cast<int64_t>(kDigit < kLimbs[index]);
+    }
+  } else {
+    for (size_t index = 0; index < kLimbs.size(); ++index) {
+      digits[index] += kLimbs[index];
+      carries[index] += static_cast<int64_t>(digits[index] < kLimbs[index]);
+    }
+  }
+}
+
+// Two's complement of `number` in place: B^n - number.
+void
+Negate(limbs::Limbs& number) noexcept {
+  uint64_t carry = 1;
+  for (uint64_t& limb : number) {
+    limb = ~limb + carry;
+    carry = static_cast<uint64_t>(carry != 0 && limb == 0);
+  }
+  if (carry != 0) {
+    number.push_back(1);
+  }
+}
+
+}  // namespace
+
+BigFloatAccumulator
+MakeAccumulator() noexcept {
+  return {.limbs = {},
+          .carries = {},
+          .exp = 0,
+          .type = Type::kDefault,
+          .sign = GetPositive()};
+}
+
+void
+Add(BigFloatAccumulator& accumulator, const BigFloatView& addend) noexcept {
+  AddSigned(accumulator, addend, GetSign(addend));
+}
+
+void
+Add(BigFloatAccumulator& accumulator, const BigFloat& addend) noexcept {
+  AddSigned(accumulator, MakeView(addend), GetSign(addend));
+}
+
+void
+Sub(BigFloatAccumulator& accumulator, const BigFloatView& subtrahend) noexcept {
+  AddSigned(accumulator, subtrahend, Invert(GetSign(subtrahend)));
+}
+
+void
+Sub(BigFloatAccumulator& accumulator, const BigFloat& subtrahend) noexcept {
+  AddSigned(accumulator, MakeView(subtrahend), Invert(GetSign(subtrahend)));
+}
+
+// A final carry of -1 means the sum is negative and the resolved limbs hold
+// its two's complement.
+BigFloat
+ToBigFloat(const BigFloatAccumulator& accumulator) noexcept {
+  if (accumulator.type == Type::kNan) {
+    return MakeNan();
+  }
+  if (accumulator.type == Type::kInf) {
+    return MakeInf(accumulator.sign);
+  }
+
+  BigUInt mantissa;
+  mantissa.limbs.resize(accumulator.limbs.size());
+  SignedWide carry = 0;
+  for (size_t index = 0; index < accumulator.limbs.size(); ++index) {
+    carry += SignedWide{accumulator.limbs[index]} +
+             accumulator.carries[index];
+    mantissa.limbs[index] = static_cast<uint64_t>(carry);
+    carry >>= kLimbShift;
+  }
+  while (carry != 0 && carry != -1) {
+    mantissa.limbs.push_back(static_cast<uint64_t>(carry));
+    carry >>= kLimbShift;
+  }
+  const Sign kSign = carry < 0 ? GetNegative() : GetPositive();
+  if (carry < 0) {
+    Negate(mantissa.limbs);
+  }
+
+  mantissa.limbs.resize(limbs::Trim(mantissa.limbs).size());
+  if (mantissa.limbs.empty()) {
+    return MakeZero();
+  }
+  return MakeBigFloat(std::move(mantissa), accumulator.exp, kSign,
+                      Type::kDefault, GetDefaultError());
+}
+
+BigFloat
+Truncate(const BigFloatAccumulator& accumulator,
+         Precision precision) noexcept {
+  return Truncate(ToBigFloat(accumulator), precision);
+}
+
+}  // namespace big_float
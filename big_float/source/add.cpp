@@ -1,11 +1,17 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
+#include <utility>
 
 #include "big_float.hpp"
+#include "big_float_view.hpp"
 #include "big_uint.hpp"
+#include "budget.hpp"
+#include "builders.hpp"
 #include "error.hpp"
 #include "exponent.hpp"
 #include "getters.hpp"
+#include "limbs.hpp"
 #include "sign.hpp"
 #include "type.hpp"
 
@@ -17,7 +23,11 @@ namespace {
 BigFloat
 AddNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
   if (!IsEqual(GetSign(lhs), GetSign(rhs))) {
-    return Sub(lhs, Neg(rhs));
+    return Sub(MakeView(lhs), Neg(MakeView(rhs)));
+  }
+
+  if (!FitsMemoryBudget(GetAlignedSize(MakeView(lhs), MakeView(rhs)) + 1)) {
+    return MakeOverBudget();
   }
 
   const Exponent kLhsExp = GetExponent(lhs);
@@ -51,41 +61,75 @@ AddNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
 }
 
 BigFloat
-AddNonSpecialToSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+AddNonSpecial(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
+  if (!IsEqual(GetSign(lhs), GetSign(rhs))) {
+    return Sub(lhs, Neg(rhs));
+  }
+  if (!FitsMemoryBudget(GetAlignedSize(lhs, rhs) + 1)) {
+    return MakeOverBudget();
+  }
+
+  const Exponent kLhsExp = GetExponent(lhs);
+  const Exponent kRhsExp = GetExponent(rhs);
+  const Exponent kResultExponent = std::min(kLhsExp, kRhsExp);
+  const Sign kResultSign = GetSign(lhs);
+
+  BigUInt result_mantissa;
+  if (kLhsExp >= kRhsExp) {
+    const auto kShift = static_cast<size_t>(kLhsExp - kRhsExp);
+    result_mantissa.limbs = limbs::Add(GetLimbs(lhs), GetLimbs(rhs), kShift);
+  } else {
+    const auto kShift = static_cast<size_t>(kRhsExp - kLhsExp);
+    result_mantissa.limbs = limbs::Add(GetLimbs(rhs), GetLimbs(lhs), kShift);
+  }
+
+  if (limbs::IsZero(result_mantissa.limbs)) {
+    return MakeZero();
+  }
+
+  return MakeBigFloat(std::move(result_mantissa), kResultExponent,
+                      kResultSign, Type::kDefault, GetDefaultError());
+}
+
+template <typename Number>
+BigFloat
+AddNonSpecialToSpecial(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
     case Type::kInf:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kZero:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kDefault:
       return AddNonSpecial(lhs, rhs);
   }
 }
 
+template <typename Number>
 BigFloat
-AddFromInf(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+AddFromInf(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kZero:
     case Type::kDefault:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kInf:
       const bool kIsEqualBySign = IsEqual(GetSign(lhs), GetSign(rhs));
-      return kIsEqualBySign ? lhs : MakeNan();
+      return kIsEqualBySign ? ToBigFloat(lhs) : MakeNan();
   }
 }
 
+template <typename Number>
 BigFloat
-AddSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+AddSpecial(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(lhs)) {
     case Type::kNan:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kInf:
       return AddFromInf(lhs, rhs);
     case Type::kZero:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kDefault:
       return AddNonSpecialToSpecial(lhs, rhs);
   }
@@ -95,6 +139,14 @@ AddSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
 
 BigFloat
 Add(const BigFloat& augend, const BigFloat& addend) noexcept {
+  if (HasSpecial(augend, addend)) {
+    return AddSpecial(augend, addend);
+  }
+  return AddNonSpecial(augend, addend);
+}
+
+BigFloat
+Add(const BigFloatView& augend, const BigFloatView& addend) noexcept {
   if (IsSpecial(augend) || IsSpecial(addend)) {
     return AddSpecial(augend, addend);
   }
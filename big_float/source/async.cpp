@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "async.hpp"
+#include "big_float.hpp"
+#include "budget.hpp"
+#include "checkpoint.hpp"
+#include "error.hpp"
+#include "executor.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr uint64_t kReports = 256;
+constexpr uint64_t kParallelTerms = 64;
+
+// An executor with no threads beyond the caller runs tasks inline, which
+// would finish the call before its future is returned; such calls get a
+// thread of their own instead.
+void
+Submit(Task task) noexcept {
+  const std::shared_ptr<const Executor> kExecutor = GetExecutor();
+  if (kExecutor->concurrency <= 1) {
+    std::thread(std::move(task)).detach();
+    return;
+  }
+  kExecutor->submit(std::move(task));
+}
+
+// Runs `compute` on the executor; a stopped call resolves to NaN carrying
+// the reason instead of its partial result.
+template <typename Compute>
+std::future<BigFloat>
+Launch(AsyncOptions options, Compute compute) noexcept {
+  auto checkpoint = std::make_shared<Checkpoint>();
+  checkpoint->options = std::move(options);
+  auto promise = std::make_shared<std::promise<BigFloat>>();
+  std::future<BigFloat> result = promise->get_future();
+  Submit([checkpoint, promise, compute = std::move(compute),
+          kBudget = GetMemoryBudget()] {
+    const size_t kWorkerBudget = GetMemoryBudget();
+    SetMemoryBudget(kBudget);
+    BigFloat value = compute(checkpoint.get());
+    SetMemoryBudget(kWorkerBudget);
+    const ErrorCode kStop = checkpoint->stop.load();
+    if (kStop != ErrorCode::kOk) {
+      value = MakeNan(GetPositive(), MakeError(kStop));
+    }
+    promise->set_value(std::move(value));
+  });
+  return result;
+}
+
+}  // namespace
+
+CancelToken
+MakeCancelToken() noexcept {
+  return {.is_cancelled = std::make_shared<std::atomic<bool>>(false)};
+}
+
+void
+Cancel(const CancelToken& token) noexcept {
+  if (token.is_cancelled) {
+    token.is_cancelled->store(true, std::memory_order_relaxed);
+  }
+}
+
+bool
+IsCancelled(const CancelToken& token) noexcept {
+  return token.is_cancelled &&
+         token.is_cancelled->load(std::memory_order_relaxed);
+}
+
+bool
+ShouldStop(Checkpoint* checkpoint) noexcept {
+  if (checkpoint == nullptr) {
+    return false;
+  }
+  if (checkpoint->stop.load(std::memory_order_relaxed) != ErrorCode::kOk) {
+    return true;
+  }
+  const AsyncOptions& kOptions = checkpoint->options;
+  ErrorCode stop = ErrorCode::kOk;
+  if (IsCancelled(kOptions.token)) {
+    stop = ErrorCode::kCancelled;
+  } else if (kOptions.deadline &&
+             std::chrono::steady_clock::now() >= *kOptions.deadline) {
+    stop = ErrorCode::kDeadlineExceeded;
+  } else {
+    return false;
+  }
+  ErrorCode expected = ErrorCode::kOk;
+  checkpoint->stop.compare_exchange_strong(expected, stop);
+  return true;
+}
+
+void
+SetTotal(Checkpoint* checkpoint, uint64_t total) noexcept {
+  if (checkpoint != nullptr) {
+    checkpoint->total.store(total, std::memory_order_relaxed);
+  }
+}
+
+// Calls back whenever `done` crosses one of kReports even steps of `total`,
+// and once more on completion.
+void
+Advance(Checkpoint* checkpoint, uint64_t units) noexcept {
+  if (checkpoint == nullptr || !checkpoint->options.progress) {
+    return;
+  }
+  const uint64_t kBefore = checkpoint->done.fetch_add(units);
+  const uint64_t kDone = kBefore + units;
+  const uint64_t kTotal = checkpoint->total.load(std::memory_order_relaxed);
+  const uint64_t kStep = std::max<uint64_t>(kTotal / kReports, 1);
+  if (kDone / kStep != kBefore / kStep || kDone == kTotal) {
+    checkpoint->options.progress(kDone, kTotal);
+  }
+}
+
+std::future<BigFloat>
+DivAsync(BigFloat dividend, BigFloat divisor, Precision precision,
+         AsyncOptions options) noexcept {
+  return Launch(std::move(options),
+                [dividend = std::move(dividend), divisor = std::move(divisor),
+                 precision](Checkpoint* checkpoint) {
+                  return Div(dividend, divisor, precision, checkpoint);
+                });
+}
+
+std::future<BigFloat>
+ExpAsync(BigFloat exponent, Precision precision,
+         AsyncOptions options) noexcept {
+  return Launch(std::move(options), [exponent = std::move(exponent),
+                                     precision](Checkpoint* checkpoint) {
+    return Exp(exponent, precision, checkpoint);
+  });
+}
+
+std::future<BigFloat>
+ComputePiAsync(Precision precision, AsyncOptions options) noexcept {
+  return Launch(std::move(options), [precision](Checkpoint* checkpoint) {
+    return ComputePi(precision, MakeParallelism(kParallelTerms), checkpoint);
+  });
+}
+
+}  // namespace big_float
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "getters.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr Precision kSeedPrecision = 48;
+constexpr uint64_t kThreeQuarters = 3;
+
+// pi * multiple / 2^shift with sign `sign`.
+BigFloat
+GetPiFraction(uint64_t multiple, int64_t shift, Sign sign,
+              Precision precision) noexcept {
+  const BigFloat kPi = GetConstant(Constant::kPi, precision + kGuardBits);
+  const BigFloat kScaled = Scale(Mul(MakeInteger(multiple, sign), kPi), -shift);
+  return Truncate(kScaled, precision);
+}
+
+// z' = z + (x cos z - sin z) / (cos z + x sin z), i.e. z plus tan(atan(x) - z),
+// which agrees with the exact correction to third order.
+BigFloat
+AtanNewton(const BigFloat& operand, Precision working) noexcept {
+  const Approximation kApproximation = Approximate(operand);
+  const double kValue =
+      std::ldexp(static_cast<double>(kApproximation.top),
+                 static_cast<int>(kApproximation.bit_exponent));
+  BigFloat result =
+      MakeFromDouble(std::atan(IsNegative(operand) ? -kValue : kValue));
+  Precision step = kSeedPrecision;
+  while (step < working) {
+    step = std::min(2 * step, working);
+    const Precision kStep = step + kGuardBits;
+    const SineCosine kSinCos = SinCos(result, kStep);
+    const BigFloat kNumerator =
+        Sub(Truncate(Mul(operand, kSinCos.cos), kStep), kSinCos.sin);
+    const BigFloat kDenominator =
+        Add(kSinCos.cos, Truncate(Mul(operand, kSinCos.sin), kStep));
+    result = Truncate(Add(result, Div(kNumerator, kDenominator, kStep)), kStep);
+  }
+  return result;
+}
+
+// atan(x) = pi / 2 - atan(1 / x) keeps the Newton argument in [-1, 1].
+BigFloat
+AtanNonSpecial(const BigFloat& operand, Precision precision) noexcept {
+  const Precision kWorking = precision + kGuardBits;
+  const BigFloat kOne = MakeInteger(1);
+  if (!IsGreater(Abs(operand), kOne)) {
+    return Truncate(AtanNewton(operand, kWorking), precision);
+  }
+  const BigFloat kInverse = Div(kOne, Abs(operand), kWorking);
+  const BigFloat kQuarterTurn =
+      GetPiFraction(1, 1, GetPositive(), kWorking);
+  const BigFloat kResult = Sub(kQuarterTurn, AtanNewton(kInverse, kWorking));
+  return Truncate(IsNegative(operand) ? Neg(kResult) : kResult, precision);
+}
+
+BigFloat
+AtanSpecial(const BigFloat& operand, Precision precision) noexcept {
+  switch (GetType(operand)) {
+    case Type::kNan:
+    case Type::kZero:
+      return operand;
+    case Type::kInf:
+      return GetPiFraction(1, 1, GetSign(operand), precision);
+    case Type::kDefault:
+      return MakeNan();
+  }
+}
+
+// Angle when x or y is zero or infinite.
+BigFloat
+Atan2Special(const BigFloat& y, const BigFloat& x,
+             Precision precision) noexcept {
+  const Sign kSign = GetSign(y);
+  if (IsNan(y) || IsNan(x)) {
+    return MakeNan();
+  }
+  if (IsInf(y)) {
+    if (!IsInf(x)) {
+      return GetPiFraction(1, 1, kSign, precision);
+    }
+    const uint64_t kMultiple = IsNegative(x) ? kThreeQuarters : 1;
+    return GetPiFraction(kMultiple, 2, kSign, precision);
+  }
+  if (IsZero(y) || IsInf(x)) {
+    return IsNegative(x) ? GetPiFraction(1, 0, kSign, precision)
+                         : MakeZero(kSign);
+  }
+  return GetPiFraction(1, 1, kSign, precision);
+}
+
+}  // namespace
+
+BigFloat
+Atan(const BigFloat& operand, Precision precision) noexcept {
+  if (IsSpecial(operand)) {
+    return AtanSpecial(operand, precision);
+  }
+  return AtanNonSpecial(operand, precision);
+}
+
+BigFloat
+Atan2(const BigFloat& y, const BigFloat& x, Precision precision) noexcept {
+  if (HasSpecial(y, x)) {
+    return Atan2Special(y, x, precision);
+  }
+  const Precision kWorking = precision + kGuardBits;
+  const BigFloat kAngle = Atan(Div(y, x, kWorking), kWorking);
+  if (!IsNegative(x)) {
+    return Truncate(kAngle, precision);
+  }
+  const BigFloat kHalfTurn = GetPiFraction(1, 0, GetSign(y), kWorking);
+  return Truncate(Add(kAngle, kHalfTurn), precision);
+}
+
+}  // namespace big_float
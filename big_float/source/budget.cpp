@@ -0,0 +1,28 @@
+#include "budget.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace big_float {
+namespace {
+
+thread_local size_t memory_budget = 0;
+
+}  // namespace
+
+void
+SetMemoryBudget(size_t bytes) noexcept {
+  memory_budget = bytes;
+}
+
+size_t
+GetMemoryBudget() noexcept {
+  return memory_budget;
+}
+
+bool
+FitsMemoryBudget(uint64_t limbs) noexcept {
+  return memory_budget == 0 || limbs <= memory_budget / sizeof(uint64_t);
+}
+
+}  // namespace big_float
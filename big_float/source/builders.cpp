@@ -0,0 +1,146 @@
+#include "builders.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+constexpr int64_t kLimbBits = 64;
+constexpr int64_t kTopBit = kLimbBits - 1;
+constexpr int kDoubleDigits = 53;
+constexpr Precision kSeriesGuardBits = 64;
+constexpr int64_t kSeriesMargin = 2;
+
+}  // namespace
+
+BigFloat
+MakeInteger(uint64_t value, Sign sign) noexcept {
+  return MakeScaled(value, 0, sign);
+}
+
+BigFloat
+MakeSigned(int64_t value) noexcept {
+  const auto kMagnitude = static_cast<uint64_t>(value);
+  return value < 0 ? MakeInteger(0 - kMagnitude, GetNegative())
+                   : MakeInteger(kMagnitude);
+}
+
+BigFloat
+MakeOverBudget() noexcept {
+  return MakeNan(GetPositive(), MakeError(ErrorCode::kMemoryBudgetExceeded));
+}
+
+BigFloat
+MakeScaled(uint64_t value, int64_t bit_exponent, Sign sign) noexcept {
+  if (value == 0) {
+    return MakeZero(sign);
+  }
+  const int64_t kRemainder =
+      ((bit_exponent % kLimbBits) + kLimbBits) % kLimbBits;
+  const Exponent kExponent = (bit_exponent - kRemainder) / kLimbBits;
+  const int kShift = static_cast<int>(kRemainder);
+
+  BigUInt mantissa;
+  mantissa.limbs = {value << kShift};
+  if (kShift != 0 && value >> (kLimbBits - kShift) != 0) {
+    mantissa.limbs.push_back(value >> (kLimbBits - kShift));
+  }
+  return MakeBigFloat(mantissa, kExponent, sign, Type::kDefault,
+                      GetDefaultError());
+}
+
+BigFloat
+MakeFromDouble(double value) noexcept {
+  int exponent = 0;
+  const double kFraction = std::frexp(std::fabs(value), &exponent);
+  const auto kMantissa =
+      static_cast<uint64_t>(std::ldexp(kFraction, kDoubleDigits));
+  return MakeScaled(kMantissa, exponent - kDoubleDigits,
+                    value < 0 ? GetNegative() : GetPositive());
+}
+
+Approximation
+Approximate(const BigFloat& number) noexcept {
+  const limbs::LimbSpan kLimbs = limbs::Trim(GetLimbs(number));
+  if (kLimbs.empty()) {
+    return {.top = 0, .bit_exponent = 0};
+  }
+  const size_t kSize = kLimbs.size();
+  const int kLeadingZeros = std::countl_zero(kLimbs[kSize - 1]);
+  uint64_t top = kLimbs[kSize - 1] << kLeadingZeros;
+  if (kSize > 1 && kLeadingZeros != 0) {
+    top |= kLimbs[kSize - 2] >> (kLimbBits - kLeadingZeros);
+  }
+  const int64_t kTopLimb =
+      GetExponent(number) + static_cast<int64_t>(kSize) - 1;
+  return {.top = top, .bit_exponent = kTopLimb * kLimbBits - kLeadingZeros};
+}
+
+Precision
+GetBitWidth(const BigFloat& number) noexcept {
+  const limbs::LimbSpan kLimbs = limbs::Trim(GetLimbs(number));
+  if (kLimbs.empty()) {
+    return 0;
+  }
+  return (kLimbs.size() - 1) * kLimbBits + std::bit_width(kLimbs.back());
+}
+
+int64_t
+GetLeadingBit(const BigFloat& number) noexcept {
+  return Approximate(number).bit_exponent + kTopBit;
+}
+
+BigFloat
+Scale(const BigFloat& number, int64_t bit_exponent) noexcept {
+  return Ldexp(number, bit_exponent);
+}
+
+BigFloat
+TruncateFraction(const BigFloat& number, int64_t fraction_bits) noexcept {
+  if (IsSpecial(number)) {
+    return number;
+  }
+  const int64_t kSignificant = GetLeadingBit(number) + 1 + fraction_bits;
+  if (kSignificant <= 0) {
+    return MakeZero(GetSign(number));
+  }
+  return Truncate(number, static_cast<Precision>(kSignificant));
+}
+
+bool
+IsTinyForSeries(const BigFloat& number, Precision precision) noexcept {
+  const auto kHalf = static_cast<int64_t>(precision / 2);
+  return GetLeadingBit(number) < -(kHalf + kSeriesMargin);
+}
+
+BigFloat
+AddHalfSquare(const BigFloat& number, Sign sign,
+              Precision precision) noexcept {
+  const Precision kWorking = precision + kSeriesGuardBits;
+  const BigFloat kNumber = Truncate(number, kWorking);
+  const int64_t kLeading = GetLeadingBit(kNumber);
+  const int64_t kSticky = kLeading - static_cast<int64_t>(kWorking) - 1;
+  const BigFloat kHalfSquare = 2 * kLeading < kSticky
+                                   ? MakeScaled(1, kSticky)
+                                   : Scale(Sqr(kNumber), -1);
+  const BigFloat kSum = IsNegative(sign) ? Sub(kNumber, kHalfSquare)
+                                         : Add(kNumber, kHalfSquare);
+  return Truncate(kSum, precision);
+}
+
+}  // namespace big_float
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+
+namespace big_float {
+
+// `number` ~= top * 2^bit_exponent with the top bit of `top` set.
+struct Approximation {  // NOLINT
+  uint64_t top;
+  int64_t bit_exponent;
+};
+
+BigFloat
+MakeInteger(uint64_t value, Sign sign = GetPositive()) noexcept;
+
+BigFloat
+MakeSigned(int64_t value) noexcept;
+
+BigFloat
+MakeScaled(uint64_t value, int64_t bit_exponent,
+           Sign sign = GetPositive()) noexcept;
+
+// Exact value of a finite `value`.
+BigFloat
+MakeFromDouble(double value) noexcept;
+
+// NaN carrying ErrorCode::kMemoryBudgetExceeded.
+BigFloat
+MakeOverBudget() noexcept;
+
+Approximation
+Approximate(const BigFloat& number) noexcept;
+
+Precision
+GetBitWidth(const BigFloat& number) noexcept;
+
+// 2^result <= |number| < 2^(result + 1) for a non-zero finite `number`.
+int64_t
+GetLeadingBit(const BigFloat& number) noexcept;
+
+// Exact number * 2^bit_exponent.
+BigFloat
+Scale(const BigFloat& number, int64_t bit_exponent) noexcept;
+
+// `number` truncated to `fraction_bits` bits after the binary point.
+BigFloat
+TruncateFraction(const BigFloat& number, int64_t fraction_bits) noexcept;
+
+// Whether x^3 lies below `precision` bits of x, so that x + x^2/2 and
+// x - x^2/2 give expm1(x) and log1p(x).
+bool
+IsTinyForSeries(const BigFloat& number, Precision precision) noexcept;
+
+// number + sign * number^2 / 2 truncated to `precision` bits. Once the
+// square falls below the working bits it only decides the truncation, so a
+// sticky bit stands in for it and the cost does not grow with the exponent.
+BigFloat
+AddHalfSquare(const BigFloat& number, Sign sign,
+              Precision precision) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "async.hpp"
+#include "big_float.hpp"
+#include "error.hpp"
+#include "executor.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+// State of one async call, polled by the algorithms between multiplication
+// blocks. Every function below accepts a null checkpoint, which never stops
+// and reports nothing, so the synchronous entry points pass nullptr.
+struct Checkpoint {  // NOLINT
+  AsyncOptions options;
+  std::atomic<uint64_t> done = 0;
+  std::atomic<uint64_t> total = 0;
+  std::atomic<ErrorCode> stop = ErrorCode::kOk;
+};
+
+// Latches the first reason to stop; later calls keep returning true.
+bool
+ShouldStop(Checkpoint* checkpoint) noexcept;
+
+void
+SetTotal(Checkpoint* checkpoint, uint64_t total) noexcept;
+
+void
+Advance(Checkpoint* checkpoint, uint64_t units) noexcept;
+
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor, Precision precision,
+    Checkpoint* checkpoint) noexcept;
+
+BigFloat
+Exp(const BigFloat& exponent, Precision precision,
+    Checkpoint* checkpoint) noexcept;
+
+BigFloat
+ComputePi(Precision precision, const Parallelism& parallelism,
+          Checkpoint* checkpoint) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,375 @@
+#include "column.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "error.hpp"
+#include "getters.hpp"
+#include "io.hpp"
+#include "limbs.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr uint64_t kColumnMagic = 0x314C4F4354464742;  // "BGFTCOL1"
+constexpr uint32_t kColumnVersion = 1;
+constexpr size_t kWriteBufferSize = size_t{1} << 20;
+
+struct ColumnHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t entry_size;
+  uint64_t count;
+  uint64_t arena_offset;
+};
+
+struct ColumnEntry {
+  int64_t exp;
+  uint8_t type;
+  uint8_t sign;
+  uint8_t error;
+  std::array<uint8_t, 5> reserved;
+  uint64_t offset;
+  uint64_t length;
+};
+
+static_assert(sizeof(ColumnHeader) == 32);
+static_assert(sizeof(ColumnEntry) == 32);
+
+constexpr size_t kLimbSize = sizeof(uint64_t);
+
+size_t
+GetArenaOffset(size_t count) noexcept {
+  return sizeof(ColumnHeader) + count * sizeof(ColumnEntry);
+}
+
+bool
+Append(int descriptor, std::vector<std::byte>& buffer,
+       std::span<const std::byte> bytes) noexcept {
+  if (buffer.size() + bytes.size() > kWriteBufferSize) {
+    if (!io::WriteAll(descriptor, buffer)) {
+      return false;
+    }
+    buffer.clear();
+  }
+  if (bytes.size() >= kWriteBufferSize) {
+    return io::WriteAll(descriptor, bytes);
+  }
+  buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+  return true;
+}
+
+template <typename Value>
+bool
+AppendValue(int descriptor, std::vector<std::byte>& buffer,
+            const Value& value) noexcept {
+  return Append(descriptor, buffer, std::as_bytes(std::span(&value, 1)));
+}
+
+bool
+WriteNumbers(int descriptor, std::span<const BigFloat> numbers) noexcept {
+  std::vector<std::byte> buffer;
+  buffer.reserve(kWriteBufferSize);
+
+  const ColumnHeader kHeader{.magic = kColumnMagic,
+                             .version = kColumnVersion,
+                             .entry_size = sizeof(ColumnEntry),
+                             .count = numbers.size(),
+                             .arena_offset = GetArenaOffset(numbers.size())};
+  if (!AppendValue(descriptor, buffer, kHeader)) {
+    return false;
+  }
+
+  uint64_t offset = 0;
+  for (const BigFloat& number : numbers) {
+    const uint64_t kLength = IsSpecial(number) ? 0 : GetLimbs(number).size();
+    const ColumnEntry kEntry{
+        .exp = GetExponent(number),
+        .type = static_cast<uint8_t>(GetType(number)),
+        .sign = static_cast<uint8_t>(GetSign(number)),
+        .error = static_cast<uint8_t>(GetErrorCode(GetError(number))),
+        .reserved = {},
+        .offset = offset,
+        .length = kLength};
+    if (!AppendValue(descriptor, buffer, kEntry)) {
+      return false;
+    }
+    offset += kLength;
+  }
+
+  for (const BigFloat& number : numbers) {
+    if (IsSpecial(number)) {
+      continue;
+    }
+    if (!Append(descriptor, buffer, std::as_bytes(GetLimbs(number)))) {
+      return false;
+    }
+  }
+  return io::WriteAll(descriptor, buffer);
+}
+
+Column
+MakeColumnError(ErrorCode code) noexcept {
+  return {.data = nullptr, .size = 0, .count = 0, .error = MakeError(code)};
+}
+
+bool
+IsValidHeader(const ColumnHeader& header, size_t size) noexcept {
+  const size_t kMaxCount =
+      (size - sizeof(ColumnHeader)) / sizeof(ColumnEntry);
+  return header.magic == kColumnMagic && header.version == kColumnVersion &&
+         header.entry_size == sizeof(ColumnEntry) &&
+         header.count <= kMaxCount &&
+         header.arena_offset == GetArenaOffset(header.count);
+}
+
+BigFloatView
+MakeInvalidView() noexcept {
+  return MakeView({}, 0, GetPositive(), Type::kNan,
+                  MakeError(ErrorCode::kInvalidFormat));
+}
+
+Sign
+GetProductSign(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
+  return IsEqual(lhs.sign, rhs.sign) ? GetPositive() : GetNegative();
+}
+
+limbs::LimbSpan
+GetBlock(limbs::LimbSpan number, size_t index, size_t block_limbs) noexcept {
+  const size_t kOffset = index * block_limbs;
+  return number.subspan(kOffset,
+                        std::min(block_limbs, number.size() - kOffset));
+}
+
+size_t
+CountBlocks(limbs::LimbSpan number, size_t block_limbs) noexcept {
+  return (number.size() + block_limbs - 1) / block_limbs;
+}
+
+// Appends the limbs of lhs * rhs after the entry table and returns how many
+// of them are significant, or nothing when a write fails. Anti-diagonal d
+// holds the block products landing at block d, and nothing after it touches
+// that block, so the window keeps two blocks plus one limb of carries.
+std::optional<uint64_t>
+AppendProductLimbs(int descriptor, limbs::LimbSpan lhs, limbs::LimbSpan rhs,
+                   size_t block_limbs) noexcept {
+  const size_t kLhsBlocks = CountBlocks(lhs, block_limbs);
+  const size_t kRhsBlocks = CountBlocks(rhs, block_limbs);
+  const size_t kDiagonals = kLhsBlocks + kRhsBlocks - 1;
+  limbs::Limbs window(2 * block_limbs + 1);
+  for (size_t diagonal = 0; diagonal < kDiagonals; ++diagonal) {
+    const size_t kFirst =
+        diagonal >= kRhsBlocks ? diagonal - kRhsBlocks + 1 : 0;
+    const size_t kLast = std::min(diagonal, kLhsBlocks - 1);
+    for (size_t index = kFirst; index <= kLast; ++index) {
+      limbs::MulAdd(GetBlock(lhs, index, block_limbs),
+                    GetBlock(rhs, diagonal - index, block_limbs), window);
+    }
+    if (diagonal + 1 == kDiagonals) {
+      break;
+    }
+    if (!io::WriteAll(descriptor,
+                      std::as_bytes(std::span(window).first(block_limbs)))) {
+      return std::nullopt;
+    }
+    std::copy(window.begin() + static_cast<ptrdiff_t>(block_limbs),
+              window.end(), window.begin());
+    std::fill(window.begin() + static_cast<ptrdiff_t>(block_limbs) + 1,
+              window.end(), 0);
+  }
+
+  const size_t kWritten = (kDiagonals - 1) * block_limbs;
+  const limbs::LimbSpan kTail = limbs::Trim(
+      std::span(window).first(lhs.size() + rhs.size() - kWritten));
+  if (!io::WriteAll(descriptor, std::as_bytes(kTail))) {
+    return std::nullopt;
+  }
+  return kWritten + kTail.size();
+}
+
+bool
+WriteProductEntry(int descriptor, const BigFloatView& lhs,
+                  const BigFloatView& rhs, uint64_t length) noexcept {
+  const ColumnHeader kHeader{.magic = kColumnMagic,
+                             .version = kColumnVersion,
+                             .entry_size = sizeof(ColumnEntry),
+                             .count = 1,
+                             .arena_offset = GetArenaOffset(1)};
+  const Sign kSign = GetProductSign(lhs, rhs);
+  const ColumnEntry kEntry{.exp = lhs.exp + rhs.exp,
+                           .type = static_cast<uint8_t>(Type::kDefault),
+                           .sign = static_cast<uint8_t>(kSign),
+                           .error = 0,
+                           .reserved = {},
+                           .offset = 0,
+                           .length = length};
+  return ::lseek(descriptor, 0, SEEK_SET) == 0 &&
+         io::WriteAll(descriptor, std::as_bytes(std::span(&kHeader, 1))) &&
+         io::WriteAll(descriptor, std::as_bytes(std::span(&kEntry, 1)));
+}
+
+bool
+WriteLargeProduct(int descriptor, const BigFloatView& lhs,
+                  const BigFloatView& rhs, size_t block_limbs) noexcept {
+  const auto kArenaOffset = static_cast<off_t>(GetArenaOffset(1));
+  if (::lseek(descriptor, kArenaOffset, SEEK_SET) != kArenaOffset) {
+    return false;
+  }
+  const std::optional<uint64_t> kLength = AppendProductLimbs(
+      descriptor, limbs::Trim(lhs.limbs), limbs::Trim(rhs.limbs),
+      block_limbs);
+  return kLength && WriteProductEntry(descriptor, lhs, rhs, *kLength);
+}
+
+}  // namespace
+
+Error
+WriteColumn(const std::string& path,
+            std::span<const BigFloat> numbers) noexcept {
+  const int kDescriptor =
+      ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (kDescriptor < 0) {
+    return MakeError(ErrorCode::kIoError);
+  }
+  const bool kIsWritten = WriteNumbers(kDescriptor, numbers);
+  const bool kIsClosed = ::close(kDescriptor) == 0;
+  return kIsWritten && kIsClosed ? GetDefaultError()
+                                 : MakeError(ErrorCode::kIoError);
+}
+
+Column
+OpenColumn(const std::string& path, ColumnAccess access) noexcept {
+  const int kDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (kDescriptor < 0) {
+    return MakeColumnError(ErrorCode::kIoError);
+  }
+
+  struct stat info {};
+  if (::fstat(kDescriptor, &info) != 0) {
+    ::close(kDescriptor);
+    return MakeColumnError(ErrorCode::kIoError);
+  }
+  const auto kSize = static_cast<size_t>(info.st_size);
+  if (kSize < sizeof(ColumnHeader)) {
+    ::close(kDescriptor);
+    return MakeColumnError(ErrorCode::kInvalidFormat);
+  }
+
+  void* address =
+      ::mmap(nullptr, kSize, PROT_READ, MAP_SHARED, kDescriptor, 0);
+  ::close(kDescriptor);
+  if (address == MAP_FAILED) {
+    return MakeColumnError(ErrorCode::kIoError);
+  }
+  const int kAdvice =
+      access == ColumnAccess::kSequential ? MADV_SEQUENTIAL : MADV_RANDOM;
+  ::madvise(address, kSize, kAdvice);
+
+  std::shared_ptr<const std::byte> data(
+      static_cast<const std::byte*>(address),
+      [address, kSize](const std::byte*) { ::munmap(address, kSize); });
+
+  ColumnHeader header{};
+  std::memcpy(&header, data.get(), sizeof(header));
+  if (!IsValidHeader(header, kSize)) {
+    return MakeColumnError(ErrorCode::kInvalidFormat);
+  }
+
+  return {.data = std::move(data),
+          .size = kSize,
+          .count = header.count,
+          .error = GetDefaultError()};
+}
+
+const Error&
+GetError(const Column& column) noexcept {
+  return column.error;
+}
+
+size_t
+GetCount(const Column& column) noexcept {
+  return column.count;
+}
+
+BigFloatView
+GetView(const Column& column, size_t index) noexcept {
+  if (!IsOk(GetError(column)) || index >= GetCount(column)) {
+    return MakeInvalidView();
+  }
+
+  const std::byte* base = column.data.get();
+  ColumnEntry entry{};
+  std::memcpy(&entry,
+              base + sizeof(ColumnHeader) + index * sizeof(ColumnEntry),
+              sizeof(entry));
+
+  const size_t kArenaOffset = GetArenaOffset(GetCount(column));
+  const size_t kArenaLimbs = (column.size - kArenaOffset) / kLimbSize;
+  const bool kIsInArena = entry.offset <= kArenaLimbs &&
+                          entry.length <= kArenaLimbs - entry.offset;
+  if (!kIsInArena || entry.type > static_cast<uint8_t>(Type::kNan) ||
+      !IsErrorCode(entry.error) || entry.exp > kMaxExponent ||
+      entry.exp < kMinExponent) {
+    return MakeInvalidView();
+  }
+
+  const auto* arena =
+      reinterpret_cast<const uint64_t*>(base + kArenaOffset);  // NOLINT
+  return MakeView(std::span(arena + entry.offset, entry.length), entry.exp,
+                  entry.sign != 0, static_cast<Type>(entry.type),
+                  MakeError(static_cast<ErrorCode>(entry.error)));
+}
+
+Error
+WriteProduct(const std::string& path, const BigFloatView& lhs,
+             const BigFloatView& rhs, size_t block_limbs) noexcept {
+  if (block_limbs == 0) {
+    return MakeError(ErrorCode::kError);
+  }
+  if (IsSpecial(lhs) || IsSpecial(rhs)) {
+    const BigFloat kProduct = Mul(lhs, rhs);
+    return WriteColumn(path, std::span(&kProduct, 1));
+  }
+  if (limbs::IsZero(lhs.limbs) || limbs::IsZero(rhs.limbs)) {
+    const BigFloat kZero = MakeZero(GetProductSign(lhs, rhs));
+    return WriteColumn(path, std::span(&kZero, 1));
+  }
+  const Exponent kExponent = lhs.exp + rhs.exp;
+  if (kExponent > kMaxExponent || kExponent < kMinExponent) {
+    const Sign kSign = GetProductSign(lhs, rhs);
+    const BigFloat kSaturated =
+        kExponent > 0 ? MakeInf(kSign) : MakeZero(kSign);
+    return WriteColumn(path, std::span(&kSaturated, 1));
+  }
+
+  const int kDescriptor =
+      ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (kDescriptor < 0) {
+    return MakeError(ErrorCode::kIoError);
+  }
+  const bool kIsWritten =
+      WriteLargeProduct(kDescriptor, lhs, rhs, block_limbs);
+  const bool kIsClosed = ::close(kDescriptor) == 0;
+  return kIsWritten && kIsClosed ? GetDefaultError()
+                                 : MakeError(ErrorCode::kIoError);
+}
+
+}  // namespace big_float
@@ -1,13 +1,12 @@
+#include <compare>
 #include <cstdint>
 
 #include "big_float.hpp"
-#include "big_uint.hpp"
+#include "big_float_view.hpp"
 #include "getters.hpp"
 #include "sign.hpp"
 #include "type.hpp"
 
-using big_uint::BigUInt;
-
 namespace big_float {
 namespace {
 
@@ -24,7 +23,7 @@ Neg(Comparison value) {
 }
 
 Comparison
-CompareBySign(const BigFloat& lhs, const BigFloat& rhs) {
+CompareBySign(const BigFloatView& lhs, const BigFloatView& rhs) {
   const Sign kLhsSign = GetSign(lhs);
   const Sign kRhsSign = GetSign(rhs);
   if (IsEqual(kLhsSign, kRhsSign)) {
@@ -37,9 +36,9 @@ CompareBySign(const BigFloat& lhs, const BigFloat& rhs) {
 }
 
 Comparison
-CompareByLength(const BigFloat& lhs, const BigFloat& rhs) {
-  const int64_t kLhsPower = CountPower(lhs);
-  const int64_t kRhsPower = CountPower(rhs);
+CompareByLength(const BigFloatView& lhs, const BigFloatView& rhs) {
+  const int64_t kLhsPower = CountBits(lhs);
+  const int64_t kRhsPower = CountBits(rhs);
   if (kLhsPower == kRhsPower) {
     return Comparison::kEqual;
   }
@@ -50,20 +49,19 @@ CompareByLength(const BigFloat& lhs, const BigFloat& rhs) {
 }
 
 Comparison
-CompareByValue(const BigFloat& lhs, const BigFloat& rhs) {
-  const BigUInt kLhsMantissa = GetMantissa(lhs);
-  const BigUInt kRhsMantissa = GetMantissa(rhs);
-  if (isEqual(kLhsMantissa, kRhsMantissa)) {
+CompareByValue(const BigFloatView& lhs, const BigFloatView& rhs) {
+  const std::strong_ordering kOrder = CompareMagnitudes(lhs, rhs);
+  if (kOrder == std::strong_ordering::equal) {
     return Comparison::kEqual;
   }
-  if (isGreater(kLhsMantissa, kRhsMantissa)) {
+  if (kOrder == std::strong_ordering::greater) {
     return Comparison::kGreater;
   }
   return Comparison::kLower;
 }
 
 Comparison
-CompareNonSpecial(const BigFloat& lhs, const BigFloat& rhs) {
+CompareNonSpecial(const BigFloatView& lhs, const BigFloatView& rhs) {
   const Comparison kBySign = CompareBySign(lhs, rhs);
   if (kBySign != Comparison::kEqual) {
     return kBySign;
@@ -80,7 +78,7 @@ CompareNonSpecial(const BigFloat& lhs, const BigFloat& rhs) {
 }
 
 Comparison
-CompareNonSpecialWithSpecial(const BigFloat& lhs, const BigFloat& rhs) {
+CompareNonSpecialWithSpecial(const BigFloatView& lhs, const BigFloatView& rhs) {
   switch (GetType(rhs)) {
     case Type::kNan:
       return Comparison::kNotEqual;
@@ -94,7 +92,7 @@ CompareNonSpecialWithSpecial(const BigFloat& lhs, const BigFloat& rhs) {
 }
 
 Comparison
-CompareZero(const BigFloat& rhs) {
+CompareZero(const BigFloatView& rhs) {
   switch (GetType(rhs)) {
     case Type::kNan:
       return Comparison::kNotEqual;
@@ -107,7 +105,7 @@ CompareZero(const BigFloat& rhs) {
 }
 
 Comparison
-CompareInf(const BigFloat& lhs, const BigFloat& rhs) {
+CompareInf(const BigFloatView& lhs, const BigFloatView& rhs) {
   switch (GetType(rhs)) {
     case Type::kNan:
       return Comparison::kNotEqual;
@@ -123,7 +121,7 @@ CompareInf(const BigFloat& lhs, const BigFloat& rhs) {
 }
 
 Comparison
-CompareSpecial(const BigFloat& lhs, const BigFloat& rhs) {
+CompareSpecial(const BigFloatView& lhs, const BigFloatView& rhs) {
   switch (GetType(lhs)) {
     case Type::kNan:
       return Comparison::kNotEqual;
@@ -137,7 +135,7 @@ CompareSpecial(const BigFloat& lhs, const BigFloat& rhs) {
 }
 
 Comparison
-Compare(const BigFloat& lhs, const BigFloat& rhs) {
+Compare(const BigFloatView& lhs, const BigFloatView& rhs) {
   if (IsSpecial(lhs) || IsSpecial(rhs)) {
     return CompareSpecial(lhs, rhs);
   }
@@ -148,16 +146,31 @@ Compare(const BigFloat& lhs, const BigFloat& rhs) {
 
 bool
 IsEqual(const BigFloat& left, const BigFloat& right) noexcept {
-  return Compare(left, right) == Comparison::kEqual;
+  return Compare(MakeView(left), MakeView(right)) == Comparison::kEqual;
 }
 
 bool
 IsGreater(const BigFloat& left, const BigFloat& right) noexcept {
-  return Compare(left, right) == Comparison::kGreater;
+  return Compare(MakeView(left), MakeView(right)) == Comparison::kGreater;
 }
 
 bool
 IsLower(const BigFloat& left, const BigFloat& right) noexcept {
+  return Compare(MakeView(left), MakeView(right)) == Comparison::kLower;
+}
+
+bool
+IsEqual(const BigFloatView& left, const BigFloatView& right) noexcept {
+  return Compare(left, right) == Comparison::kEqual;
+}
+
+bool
+IsGreater(const BigFloatView& left, const BigFloatView& right) noexcept {
+  return Compare(left, right) == Comparison::kGreater;
+}
+
+bool
+IsLower(const BigFloatView& left, const BigFloatView& right) noexcept {
   return Compare(left, right) == Comparison::kLower;
 }
 
@@ -0,0 +1,86 @@
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "constants.hpp"
+#include "precision.hpp"
+#include "shared.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kLimbBits = 64;
+constexpr size_t kConstantCount = 4;
+
+struct CacheEntry {  // NOLINT
+  std::mutex mutex;
+  std::condition_variable is_ready;
+  SharedBigFloat value;
+  Precision precision = 0;
+  bool is_computing = false;
+};
+
+std::array<CacheEntry, kConstantCount>&
+GetCache() noexcept {
+  static std::array<CacheEntry, kConstantCount> cache;
+  return cache;
+}
+
+BigFloat
+Compute(Constant constant, Precision precision) noexcept {
+  switch (constant) {
+    case Constant::kPi:
+      return ComputePi(precision);
+    case Constant::kE:
+      return ComputeE(precision);
+    case Constant::kLn2:
+      return ComputeLn2(precision);
+    case Constant::kLn10:
+      return ComputeLn10(precision);
+  }
+}
+
+Precision
+RoundToLimbs(Precision precision) noexcept {
+  return (precision + kLimbBits - 1) / kLimbBits * kLimbBits;
+}
+
+}  // namespace
+
+SharedBigFloat
+GetSharedConstant(Constant constant, Precision precision) noexcept {
+  CacheEntry& entry = GetCache()[static_cast<size_t>(constant)];
+  std::unique_lock lock(entry.mutex);
+  entry.is_ready.wait(lock, [&entry, precision] {
+    return entry.precision >= precision || !entry.is_computing;
+  });
+  if (entry.precision >= precision) {
+    return entry.value;
+  }
+
+  entry.is_computing = true;
+  lock.unlock();
+  const Precision kTarget = RoundToLimbs(precision);
+  SharedBigFloat value = Share(Compute(constant, kTarget));
+  lock.lock();
+
+  if (kTarget > entry.precision) {
+    entry.value = value;
+    entry.precision = kTarget;
+  }
+  entry.is_computing = false;
+  entry.is_ready.notify_all();
+  return value;
+}
+
+// Only the handle is copied under the cache lock; the limbs are truncated
+// after it is released.
+BigFloat
+GetConstant(Constant constant, Precision precision) noexcept {
+  return Truncate(MakeView(GetSharedConstant(constant, precision)), precision);
+}
+
+}  // namespace big_float
@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <utility>
 
 #include "big_float.hpp"
@@ -8,44 +9,52 @@
 #include "type.hpp"
 
 using big_uint::BigUInt;
-using big_uint::makeZero;
 
 namespace big_float {
 namespace {
 
-const BigUInt kZeroNumber = makeZero();
-const BigUInt kInfNumber = makeZero();
-const BigUInt kNanNumber = makeZero();
-
-constexpr Exponent kZeroExp = 0;
-constexpr Exponent kInfExp = 0;
-constexpr Exponent kNanExp = 0;
+constexpr Exponent kSpecialExp = 0;
+
+uint64_t
+PackExponentAndHeader(Exponent exp, Sign sign, Type type,
+                      const Error& error) noexcept {
+  const auto kCode = static_cast<Header>(GetErrorCode(error));
+  const auto kHeader =
+      static_cast<Header>(static_cast<Header>(type) |
+                          (IsNegative(sign) ? kSignMask : Header{0}) |
+                          kCode << kErrorShift);
+  return static_cast<uint64_t>(exp) << kHeaderBits | kHeader;
+}
 
 }  // namespace
 
 BigFloat
 MakeBigFloat(BigUInt number, Exponent exp, Sign sign, Type type,
              Error error) noexcept {
+  if (type == Type::kDefault && exp > kMaxExponent) {
+    return MakeInf(sign, error);
+  }
+  if (type == Type::kDefault && exp < kMinExponent) {
+    return MakeZero(sign, error);
+  }
   return {.number = std::move(number),
-          .exp = exp,
-          .type = type,
-          .sign = sign,
-          .error = error};
+          .exp_and_header = PackExponentAndHeader(exp, sign, type, error)};
 }
 
+// Special values keep an empty mantissa, so creating one never allocates.
 BigFloat
 MakeZero(Sign sign, const Error& error) noexcept {
-  return MakeBigFloat(kZeroNumber, kZeroExp, sign, Type::kZero, error);
+  return MakeBigFloat(BigUInt{}, kSpecialExp, sign, Type::kZero, error);
 }
 
 BigFloat
 MakeInf(Sign sign, const Error& error) noexcept {
-  return MakeBigFloat(kInfNumber, kInfExp, sign, Type::kInf, error);
+  return MakeBigFloat(BigUInt{}, kSpecialExp, sign, Type::kInf, error);
 }
 
 BigFloat
 MakeNan(Sign sign, const Error& error) noexcept {
-  return MakeBigFloat(kNanNumber, kNanExp, sign, Type::kNan, error);
+  return MakeBigFloat(BigUInt{}, kSpecialExp, sign, Type::kNan, error);
 }
 
 }  // namespace big_float
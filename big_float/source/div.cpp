@@ -0,0 +1,318 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "budget.hpp"
+#include "builders.hpp"
+#include "checkpoint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "io.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "restart.hpp"
+#include "saved_state.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+constexpr Precision kLimbBits = 64;
+constexpr Precision kGuardBits = 64;
+constexpr Precision kSeedPrecision = 128;
+constexpr size_t kNewtonThreshold = 128;
+
+Sign
+GetResultSign(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+  const bool kHasSameSign = IsEqual(GetSign(lhs), GetSign(rhs));
+  return kHasSameSign ? GetPositive() : GetNegative();
+}
+
+BigFloat
+DivSchoolbook(const BigFloat& lhs, const BigFloat& rhs,
+              Precision precision) noexcept {
+  const limbs::LimbSpan kNumerator = limbs::Trim(GetLimbs(lhs));
+  const limbs::LimbSpan kDenominator = limbs::Trim(GetLimbs(rhs));
+  const size_t kQuotientLimbs =
+      static_cast<size_t>(precision / kLimbBits) + 2 + kDenominator.size();
+  const size_t kShift = kQuotientLimbs > kNumerator.size()
+                            ? kQuotientLimbs - kNumerator.size()
+                            : 0;
+
+  limbs::Limbs scaled(kShift);
+  scaled.insert(scaled.end(), kNumerator.begin(), kNumerator.end());
+  BigUInt quotient;
+  quotient.limbs = limbs::DivMod(scaled, kDenominator).quotient;
+
+  const Exponent kExponent = GetExponent(lhs) - GetExponent(rhs) -
+                             static_cast<Exponent>(kShift);
+  return Truncate(MakeBigFloat(std::move(quotient), kExponent,
+                               GetResultSign(lhs, rhs), Type::kDefault,
+                               GetDefaultError()),
+                  precision);
+}
+
+uint64_t
+CountNewtonSteps(Precision precision) noexcept {
+  uint64_t steps = 0;
+  for (Precision working = kSeedPrecision - kGuardBits; working < precision;
+       working = std::min(2 * working, precision)) {
+    ++steps;
+  }
+  return steps;
+}
+
+BigFloat
+SeedReciprocal(const BigFloat& divisor) noexcept {
+  return DivSchoolbook(MakeInteger(1), Truncate(divisor, kSeedPrecision),
+                       kSeedPrecision);
+}
+
+// Newton step x' = x + x(1 - dx) for a positive divisor, bringing the
+// reciprocal to `working` bits.
+BigFloat
+NewtonStep(const BigFloat& divisor, const BigFloat& reciprocal,
+           Precision working) noexcept {
+  const Precision kWorking = working + kGuardBits;
+  const BigFloat kProduct =
+      Truncate(Mul(Truncate(divisor, kWorking), reciprocal), kWorking);
+  const BigFloat kResidual = Sub(MakeInteger(1), kProduct);
+  const BigFloat kCorrection = Truncate(Mul(reciprocal, kResidual), kWorking);
+  return Truncate(Add(reciprocal, kCorrection), kWorking);
+}
+
+// Doubles the working precision at every step.
+BigFloat
+Reciprocal(const BigFloat& divisor, Precision precision,
+           Checkpoint* checkpoint) noexcept {
+  BigFloat reciprocal = SeedReciprocal(divisor);
+  Precision working = kSeedPrecision - kGuardBits;
+  while (working < precision) {
+    if (ShouldStop(checkpoint)) {
+      return reciprocal;
+    }
+    working = std::min(2 * working, precision);
+    reciprocal = NewtonStep(divisor, reciprocal, working);
+    Advance(checkpoint, 1);
+  }
+  return reciprocal;
+}
+
+BigFloat
+ApplyReciprocal(const BigFloat& lhs, const BigFloat& rhs,
+                const BigFloat& reciprocal, Precision precision) noexcept {
+  const BigFloat kQuotient = Truncate(
+      Mul(Truncate(Abs(lhs), precision + kGuardBits), reciprocal), precision);
+  return IsNegative(GetResultSign(lhs, rhs)) ? Neg(kQuotient) : kQuotient;
+}
+
+BigFloat
+DivNewton(const BigFloat& lhs, const BigFloat& rhs, Precision precision,
+          Checkpoint* checkpoint) noexcept {
+  const Precision kWorking = precision + kGuardBits;
+  SetTotal(checkpoint, CountNewtonSteps(kWorking) + 1);
+  const BigFloat kReciprocal = Reciprocal(Abs(rhs), kWorking, checkpoint);
+  if (ShouldStop(checkpoint)) {
+    return MakeNan();
+  }
+  BigFloat quotient = ApplyReciprocal(lhs, rhs, kReciprocal, precision);
+  Advance(checkpoint, 1);
+  return quotient;
+}
+
+bool
+IsNewtonDivision(const BigFloat& rhs, Precision precision) noexcept {
+  const size_t kDenominatorSize = limbs::Trim(GetLimbs(rhs)).size();
+  return kDenominatorSize >= kNewtonThreshold &&
+         precision >= kNewtonThreshold * kLimbBits;
+}
+
+uint64_t
+GetFingerprint(const BigFloat& divisor) noexcept {
+  return io::Checksum(limbs::Trim(GetLimbs(divisor))) ^
+         static_cast<uint64_t>(GetExponent(divisor));
+}
+
+// Continues the reciprocal of |rhs| from `working` bits, saving it between
+// Newton steps.
+BigFloat
+RunDiv(const BigFloat& lhs, const BigFloat& rhs, Precision precision,
+       Precision working, BigFloat reciprocal,
+       const RestartOptions& options) noexcept {
+  const BigFloat kDivisor = Abs(rhs);
+  const Precision kTarget = precision + kGuardBits;
+  auto saved_at = std::chrono::steady_clock::now();
+  while (working < kTarget) {
+    working = std::min(2 * working, kTarget);
+    reciprocal = NewtonStep(kDivisor, reciprocal, working);
+    if (working == kTarget) {
+      break;
+    }
+
+    const bool kIsCancelled = IsCancelled(options.token);
+    const auto kNow = std::chrono::steady_clock::now();
+    if (kIsCancelled || kNow - saved_at >= options.interval) {
+      const SavedState kState{.kind = SavedKind::kDiv,
+                              .precision = precision,
+                              .position = working,
+                              .operand = GetFingerprint(rhs),
+                              .words = {}};
+      const BigFloatView kNumbers[] = {MakeView(reciprocal)};
+      const Error kError = SaveState(options.path, kState, kNumbers);
+      if (!IsOk(kError)) {
+        return MakeNan(GetPositive(), kError);
+      }
+      saved_at = kNow;
+    }
+    if (kIsCancelled) {
+      return MakeNan(GetPositive(), MakeError(ErrorCode::kCancelled));
+    }
+  }
+  RemoveState(options.path);
+  return ApplyReciprocal(lhs, rhs, reciprocal, precision);
+}
+
+BigFloat
+DivNonSpecial(const BigFloat& lhs, const BigFloat& rhs, Precision precision,
+              Checkpoint* checkpoint) noexcept {
+  const uint64_t kQuotientLimbs =
+      precision / kLimbBits + 2 + GetLimbs(rhs).size();
+  if (!FitsMemoryBudget(std::max<uint64_t>(kQuotientLimbs,
+                                           GetLimbs(lhs).size()))) {
+    return MakeOverBudget();
+  }
+  if (IsNewtonDivision(rhs, precision)) {
+    return DivNewton(lhs, rhs, precision, checkpoint);
+  }
+  SetTotal(checkpoint, 1);
+  if (ShouldStop(checkpoint)) {
+    return MakeNan();
+  }
+  BigFloat quotient = DivSchoolbook(lhs, rhs, precision);
+  Advance(checkpoint, 1);
+  return quotient;
+}
+
+BigFloat
+DivSpecialFromNonSpecial(const BigFloat& lhs, const BigFloat& rhs,
+                         Precision precision,
+                         Checkpoint* checkpoint) noexcept {
+  switch (GetType(rhs)) {
+    case Type::kNan:
+      return rhs;
+    case Type::kZero:
+      return MakeInf(GetResultSign(lhs, rhs));
+    case Type::kInf:
+      return MakeZero(GetResultSign(lhs, rhs));
+    case Type::kDefault:
+      return DivNonSpecial(lhs, rhs, precision, checkpoint);
+  }
+}
+
+BigFloat
+DivFromZero(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+  switch (GetType(rhs)) {
+    case Type::kNan:
+      return rhs;
+    case Type::kZero:
+      return MakeNan();
+    case Type::kInf:
+    case Type::kDefault:
+      return MakeZero(GetResultSign(lhs, rhs));
+  }
+}
+
+BigFloat
+DivFromInf(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+  switch (GetType(rhs)) {
+    case Type::kNan:
+      return rhs;
+    case Type::kInf:
+      return MakeNan();
+    case Type::kZero:
+    case Type::kDefault:
+      return MakeInf(GetResultSign(lhs, rhs));
+  }
+}
+
+BigFloat
+DivSpecial(const BigFloat& lhs, const BigFloat& rhs, Precision precision,
+           Checkpoint* checkpoint) noexcept {
+  switch (GetType(lhs)) {
+    case Type::kNan:
+      return lhs;
+    case Type::kZero:
+      return DivFromZero(lhs, rhs);
+    case Type::kInf:
+      return DivFromInf(lhs, rhs);
+    case Type::kDefault:
+      return DivSpecialFromNonSpecial(lhs, rhs, precision, checkpoint);
+  }
+}
+
+}  // namespace
+
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor) noexcept {
+  const Precision kPrecision =
+      std::max({GetBitWidth(dividend), GetBitWidth(divisor), kLimbBits});
+  return Div(dividend, divisor, kPrecision);
+}
+
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor,
+    Precision precision) noexcept {
+  return Div(dividend, divisor, precision, nullptr);
+}
+
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor, Precision precision,
+    Checkpoint* checkpoint) noexcept {
+  if (HasSpecial(dividend, divisor)) {
+    return DivSpecial(dividend, divisor, precision, checkpoint);
+  }
+  return DivNonSpecial(dividend, divisor, precision, checkpoint);
+}
+
+BigFloat
+Div(const BigFloat& dividend, const BigFloat& divisor, Precision precision,
+    const RestartOptions& options) noexcept {
+  if (HasSpecial(dividend, divisor) || !IsNewtonDivision(divisor, precision)) {
+    return Div(dividend, divisor, precision);
+  }
+  return RunDiv(dividend, divisor, precision, kSeedPrecision - kGuardBits,
+                SeedReciprocal(Abs(divisor)), options);
+}
+
+BigFloat
+ResumeDiv(const BigFloat& dividend, const BigFloat& divisor,
+          const RestartOptions& options) noexcept {
+  LoadedState loaded = LoadState(options.path, SavedKind::kDiv);
+  if (!IsOk(loaded.error)) {
+    return MakeNan(GetPositive(), loaded.error);
+  }
+  const SavedState& state = loaded.state;
+  const bool kIsValid =
+      !HasSpecial(dividend, divisor) &&
+      IsNewtonDivision(divisor, state.precision) &&
+      state.operand == GetFingerprint(divisor) &&
+      loaded.numbers.size() == 1 && !IsSpecial(loaded.numbers.front()) &&
+      state.position >= kSeedPrecision - kGuardBits &&
+      state.position < state.precision + kGuardBits;
+  if (!kIsValid) {
+    return MakeNan(GetPositive(), MakeError(ErrorCode::kInvalidFormat));
+  }
+  return RunDiv(dividend, divisor, state.precision, state.position,
+                std::move(loaded.numbers.front()), options);
+}
+
+}  // namespace big_float
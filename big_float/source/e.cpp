@@ -0,0 +1,41 @@
+#include <bit>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "constants.hpp"
+#include "precision.hpp"
+#include "series.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+
+// Smallest n with log2(n!) above `precision`.
+uint64_t
+CountTerms(Precision precision) noexcept {
+  uint64_t terms = 1;
+  for (Precision bits = 0; bits <= precision; ++terms) {
+    bits += std::bit_width(terms) - 1;
+  }
+  return terms;
+}
+
+}  // namespace
+
+BigFloat
+ComputeE(Precision precision) noexcept {
+  const Precision kWorking = precision + kGuardBits;
+  const BigFloat kOne = MakeInteger(1);
+  const auto kTerms = [&kOne](uint64_t index) {
+    return SeriesTerm{.a = kOne,
+                      .b = kOne,
+                      .p = kOne,
+                      .q = index == 0 ? kOne : MakeInteger(index)};
+  };
+  return Truncate(SumSeries(kTerms, CountTerms(kWorking), kWorking),
+                  precision);
+}
+
+}  // namespace big_float
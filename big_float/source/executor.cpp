@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "budget.hpp"
+#include "executor.hpp"
+
+namespace big_float {
+namespace {
+
+struct WorkerQueue {  // NOLINT
+  std::mutex mutex;
+  std::deque<Task> tasks;
+};
+
+// `pending` counts queued tasks. A worker takes one unit of it before it
+// searches the queues, so every worker that wakes up finds a task.
+struct ThreadPool {  // NOLINT
+  std::vector<WorkerQueue> queues;
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::condition_variable has_work;
+  size_t pending = 0;
+  bool is_stopping = false;
+  std::atomic<size_t> next_queue = 0;
+};
+
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+struct ExecutorSlot {  // NOLINT
+  std::mutex mutex;
+  std::shared_ptr<const Executor> executor;
+};
+
+ExecutorSlot&
+GetSlot() noexcept {
+  static ExecutorSlot slot;
+  return slot;
+}
+
+// Forked task that runs exactly once: on whichever thread claims it first.
+struct ForkedTask {  // NOLINT
+  const Task* task = nullptr;
+  std::atomic<bool> is_claimed = false;
+  std::mutex mutex;
+  std::condition_variable is_done;
+  bool has_finished = false;
+};
+
+void
+Submit(ThreadPool& pool, Task task) noexcept {
+  const size_t kQueue =
+      current_pool == &pool
+          ? current_queue
+          : pool.next_queue.fetch_add(1, std::memory_order_relaxed) %
+                pool.queues.size();
+  {
+    std::lock_guard lock(pool.queues[kQueue].mutex);
+    pool.queues[kQueue].tasks.push_back(std::move(task));
+  }
+  {
+    std::lock_guard lock(pool.mutex);
+    ++pool.pending;
+  }
+  pool.has_work.notify_one();
+}
+
+bool
+TryPop(ThreadPool& pool, size_t index, Task& task) noexcept {
+  {
+    WorkerQueue& own = pool.queues[index];
+    std::lock_guard lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  for (size_t step = 1; step < pool.queues.size(); ++step) {
+    WorkerQueue& other = pool.queues[(index + step) % pool.queues.size()];
+    std::lock_guard lock(other.mutex);
+    if (!other.tasks.empty()) {
+      task = std::move(other.tasks.front());
+      other.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+RunWorker(ThreadPool& pool, size_t index) noexcept {
+  current_pool = &pool;
+  current_queue = index;
+  while (true) {
+    {
+      std::unique_lock lock(pool.mutex);
+      pool.has_work.wait(
+          lock, [&pool] { return pool.pending > 0 || pool.is_stopping; });
+      if (pool.pending == 0) {
+        return;
+      }
+      --pool.pending;
+    }
+    Task task;
+    while (!TryPop(pool, index, task)) {
+      std::this_thread::yield();
+    }
+    task();
+  }
+}
+
+void
+JoinPool(ThreadPool* pool) noexcept {
+  {
+    std::lock_guard lock(pool->mutex);
+    pool->is_stopping = true;
+  }
+  pool->has_work.notify_all();
+  for (std::thread& thread : pool->threads) {
+    thread.join();
+  }
+  delete pool;  // NOLINT
+}
+
+// The last reference may go away inside one of the pool's own tasks, and a
+// worker cannot join itself, so the join then moves to a detached thread.
+void
+StopPool(ThreadPool* pool) noexcept {
+  if (current_pool == pool) {
+    std::thread(JoinPool, pool).detach();
+    return;
+  }
+  JoinPool(pool);
+}
+
+void
+RunClaimed(ForkedTask& forked) noexcept {
+  (*forked.task)();
+  {
+    std::lock_guard lock(forked.mutex);
+    forked.has_finished = true;
+  }
+  forked.is_done.notify_one();
+}
+
+size_t
+GetDefaultThreads() noexcept {
+  return std::max(1U, std::thread::hardware_concurrency()) - 1;
+}
+
+}  // namespace
+
+Executor
+MakeThreadPool(size_t threads) noexcept {
+  if (threads == 0) {
+    return {.submit = [](Task task) { task(); }, .concurrency = 1};
+  }
+  std::shared_ptr<ThreadPool> pool(new ThreadPool, StopPool);  // NOLINT
+  pool->queues = std::vector<WorkerQueue>(threads);
+  for (size_t index = 0; index < threads; ++index) {
+    pool->threads.emplace_back(RunWorker, std::ref(*pool), index);
+  }
+  return {.submit = [pool](Task task) { Submit(*pool, std::move(task)); },
+          .concurrency = threads + 1};
+}
+
+void
+SetExecutor(Executor executor) noexcept {
+  auto shared = std::make_shared<const Executor>(std::move(executor));
+  ExecutorSlot& slot = GetSlot();
+  std::lock_guard lock(slot.mutex);
+  slot.executor = std::move(shared);
+}
+
+std::shared_ptr<const Executor>
+GetExecutor() noexcept {
+  ExecutorSlot& slot = GetSlot();
+  std::lock_guard lock(slot.mutex);
+  if (!slot.executor) {
+    slot.executor =
+        std::make_shared<const Executor>(MakeThreadPool(GetDefaultThreads()));
+  }
+  return slot.executor;
+}
+
+Parallelism
+MakeParallelism(uint64_t grain) noexcept {
+  std::shared_ptr<const Executor> executor = GetExecutor();
+  const size_t kConcurrency = std::max<size_t>(executor->concurrency, 1);
+  const auto kDepth = static_cast<int>(std::bit_width(kConcurrency)) - 1;
+  return {.executor = std::move(executor), .depth = kDepth, .grain = grain};
+}
+
+Parallelism
+MakeParallelism(int depth, uint64_t grain) noexcept {
+  return {.executor = GetExecutor(), .depth = depth, .grain = grain};
+}
+
+Parallelism
+Descend(const Parallelism& parallelism) noexcept {
+  return {.executor = parallelism.executor,
+          .depth = parallelism.depth - 1,
+          .grain = parallelism.grain};
+}
+
+void
+ForkJoin(const Parallelism& parallelism, uint64_t size, const Task& left,
+         const Task& right) noexcept {
+  if (parallelism.depth <= 0 || size < parallelism.grain ||
+      !parallelism.executor) {
+    left();
+    right();
+    return;
+  }
+
+  auto forked = std::make_shared<ForkedTask>();
+  forked->task = &left;
+  parallelism.executor->submit([forked, kBudget = GetMemoryBudget()] {
+    if (!forked->is_claimed.exchange(true)) {
+      const size_t kWorkerBudget = GetMemoryBudget();
+      SetMemoryBudget(kBudget);
+      RunClaimed(*forked);
+      SetMemoryBudget(kWorkerBudget);
+    }
+  });
+  right();
+  if (!forked->is_claimed.exchange(true)) {
+    left();
+    return;
+  }
+  std::unique_lock lock(forked->mutex);
+  forked->is_done.wait(lock, [&forked] { return forked->has_finished; });
+}
+
+}  // namespace big_float
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+#include "accumulator.hpp"
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "checkpoint.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "getters.hpp"
+#include "precision.hpp"
+#include "series.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr Precision kSplittingThreshold = 4096;
+constexpr int64_t kOverflowBit = 60;
+constexpr double kLn2 = 0.69314718055994530942;
+
+// Number of Taylor terms for |y| < 2^-magnitude: n * magnitude + log2(n!)
+// must exceed `precision`.
+uint64_t
+CountTerms(int64_t magnitude, Precision precision) noexcept {
+  const auto kPrecision = static_cast<int64_t>(precision);
+  uint64_t terms = 1;
+  for (int64_t bits = 0; bits <= kPrecision; ++terms) {
+    bits += magnitude + static_cast<int64_t>(std::bit_width(terms)) - 1;
+  }
+  return terms;
+}
+
+// First bit-burst stage takes twice the leading zero fraction bits.
+int64_t
+GetFirstFractionBits(const BigFloat& reduced) noexcept {
+  return 2 * std::max<int64_t>(-GetLeadingBit(reduced), 1);
+}
+
+uint64_t
+CountStages(int64_t fraction_bits, int64_t working) noexcept {
+  uint64_t stages = 1;
+  for (; fraction_bits < working; fraction_bits *= 2) {
+    ++stages;
+  }
+  return stages;
+}
+
+BigFloat
+ExpTaylor(const BigFloat& reduced, Precision working,
+          Checkpoint* checkpoint) noexcept {
+  const uint64_t kTerms = CountTerms(-GetLeadingBit(reduced), working);
+  BigFloat term = MakeInteger(1);
+  BigFloatAccumulator sum = MakeAccumulator();
+  Add(sum, term);
+  for (uint64_t index = 1; index < kTerms && !ShouldStop(checkpoint);
+       ++index) {
+    term = Div(Mul(term, reduced), index, working);
+    Add(sum, term);
+    Advance(checkpoint, 1);
+  }
+  return Truncate(sum, working);
+}
+
+BigFloat
+ExpSplit(const BigFloat& reduced, Precision working) noexcept {
+  const BigFloat kOne = MakeInteger(1);
+  const auto kTerms = [&](uint64_t index) {
+    return SeriesTerm{.a = kOne,
+                      .b = kOne,
+                      .p = index == 0 ? kOne : reduced,
+                      .q = index == 0 ? kOne : MakeInteger(index)};
+  };
+  const uint64_t kCount = CountTerms(-GetLeadingBit(reduced), working);
+  return SumSeries(kTerms, kCount, working);
+}
+
+// Bit-burst: exp(y) = prod exp(y_i), where y_i holds bits (L/2, L] of y
+// after the binary point, so every series has a short numerator.
+BigFloat
+ExpBitBurst(const BigFloat& reduced, Precision working,
+            Checkpoint* checkpoint) noexcept {
+  const auto kWorking = static_cast<int64_t>(working);
+  BigFloat result = MakeInteger(1);
+  BigFloat taken = MakeZero();
+  int64_t fraction_bits = GetFirstFractionBits(reduced);
+  while (!ShouldStop(checkpoint)) {
+    const BigFloat kCurrent = TruncateFraction(reduced, fraction_bits);
+    const BigFloat kPart = Sub(kCurrent, taken);
+    if (!IsZero(kPart)) {
+      result = Truncate(Mul(result, ExpSplit(kPart, working)), working);
+    }
+    Advance(checkpoint, 1);
+    if (fraction_bits >= kWorking) {
+      return result;
+    }
+    taken = kCurrent;
+    fraction_bits *= 2;
+  }
+  return result;
+}
+
+// exp(x) = 2^k exp(r)^(2^s) with r = (x - k ln 2) / 2^s.
+BigFloat
+ExpNonSpecial(const BigFloat& exponent, Precision precision,
+              Checkpoint* checkpoint) noexcept {
+  if (GetLeadingBit(exponent) >= kOverflowBit) {
+    return IsNegative(exponent) ? MakeZero() : MakeInf();
+  }
+
+  const Approximation kApproximation = Approximate(exponent);
+  const double kValue =
+      std::ldexp(static_cast<double>(kApproximation.top),
+                 static_cast<int>(kApproximation.bit_exponent));
+  const int64_t kTwoPower =
+      std::llround(IsNegative(exponent) ? -kValue / kLn2 : kValue / kLn2);
+  const auto kSquarings =
+      static_cast<int64_t>(std::sqrt(static_cast<double>(precision)));
+  const Precision kWorking =
+      precision + kGuardBits + static_cast<Precision>(kSquarings);
+
+  BigFloat reduced = exponent;
+  if (kTwoPower != 0) {
+    const BigFloat kMultiple = MakeSigned(kTwoPower);
+    const BigFloat kLn2Value =
+        GetConstant(Constant::kLn2, kWorking + GetBitWidth(kMultiple));
+    reduced = Sub(exponent, Mul(kMultiple, kLn2Value));
+    reduced = TruncateFraction(reduced, static_cast<int64_t>(kWorking));
+  }
+  if (IsZero(reduced)) {
+    return MakeScaled(1, kTwoPower);
+  }
+
+  reduced = Scale(reduced, -kSquarings);
+  const bool kUseBitBurst = kWorking >= kSplittingThreshold;
+  const uint64_t kSeriesSteps =
+      kUseBitBurst ? CountStages(GetFirstFractionBits(reduced),
+                                 static_cast<int64_t>(kWorking))
+                   : CountTerms(-GetLeadingBit(reduced), kWorking) - 1;
+  SetTotal(checkpoint, kSeriesSteps + static_cast<uint64_t>(kSquarings));
+  BigFloat result = kUseBitBurst ? ExpBitBurst(reduced, kWorking, checkpoint)
+                                 : ExpTaylor(reduced, kWorking, checkpoint);
+  for (int64_t step = 0; step < kSquarings; ++step) {
+    if (ShouldStop(checkpoint)) {
+      return MakeNan();
+    }
+    result = Truncate(Sqr(result), kWorking);
+    Advance(checkpoint, 1);
+  }
+  return Truncate(Scale(result, kTwoPower), precision);
+}
+
+BigFloat
+ExpSpecial(const BigFloat& exponent) noexcept {
+  switch (GetType(exponent)) {
+    case Type::kNan:
+      return exponent;
+    case Type::kZero:
+      return MakeInteger(1);
+    case Type::kInf:
+      return IsNegative(exponent) ? MakeZero() : exponent;
+    case Type::kDefault:
+      return MakeNan();
+  }
+}
+
+}  // namespace
+
+BigFloat
+Exp(const BigFloat& exponent, Precision precision) noexcept {
+  return Exp(exponent, precision, nullptr);
+}
+
+BigFloat
+Exp(const BigFloat& exponent, Precision precision,
+    Checkpoint* checkpoint) noexcept {
+  if (IsSpecial(exponent)) {
+    return ExpSpecial(exponent);
+  }
+  return ExpNonSpecial(exponent, precision, checkpoint);
+}
+
+BigFloat
+Expm1(const BigFloat& exponent, Precision precision) noexcept {
+  if (IsSpecial(exponent)) {
+    return IsInf(exponent) && IsNegative(exponent)
+               ? MakeInteger(1, GetNegative())
+               : exponent;
+  }
+  if (IsTinyForSeries(exponent, precision)) {
+    return AddHalfSquare(exponent, GetPositive(), precision);
+  }
+  const int64_t kExtra = std::max<int64_t>(-GetLeadingBit(exponent), 0);
+  const BigFloat kExp =
+      Exp(exponent, precision + kGuardBits + static_cast<Precision>(kExtra));
+  return Truncate(Sub(kExp, MakeInteger(1)), precision);
+}
+
+}  // namespace big_float
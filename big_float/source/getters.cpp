@@ -1,77 +1,77 @@
 #include "getters.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <compare>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 
 #include "big_float.hpp"
+#include "big_float_view.hpp"
 #include "big_uint.hpp"
 #include "error.hpp"
 #include "exponent.hpp"
+#include "limbs.hpp"
 #include "sign.hpp"
 #include "type.hpp"
 
 using big_uint::BigUInt;
 
 namespace big_float {
+namespace {
 
-Type
-GetType(const BigFloat& number) noexcept {
-  return number.type;
-}
-
-bool
-IsZero(const BigFloat& number) noexcept {
-  return GetType(number) == Type::kZero;
-}
-
-bool
-IsInf(const BigFloat& number) noexcept {
-  return GetType(number) == Type::kInf;
-}
-
-bool
-IsNan(const BigFloat& number) noexcept {
-  return GetType(number) == Type::kNan;
-}
-
-bool
-IsSpecial(const BigFloat& number) noexcept {
-  return GetType(number) != Type::kDefault;
-}
+constexpr int64_t kBitsPerLimb = 64;
 
-Sign
-GetSign(const BigFloat& number) noexcept {
-  return number.sign;
-}
+}  // namespace
 
-bool
-IsNegative(const BigFloat& number) noexcept {
-  return GetSign(number) == GetNegative();
+size_t
+GetSize(const BigFloat& number) noexcept {
+  return big_uint::getSize(GetMantissa(number));
 }
 
-const BigUInt&
-GetMantissa(const BigFloat& number) noexcept {
-  return number.number;
+int64_t
+CountPower(const BigFloat& number) noexcept {
+  return GetExponent(number) + static_cast<int64_t>(GetSize(number));
 }
 
-Exponent
-GetExponent(const BigFloat& number) noexcept {
-  return number.exp;
+int64_t
+CountPower(const BigFloatView& view) noexcept {
+  const auto kSize = static_cast<int64_t>(limbs::Trim(GetLimbs(view)).size());
+  return GetExponent(view) + kSize;
 }
 
-const Error&
-GetError(const BigFloat& number) noexcept {
-  return number.error;
+int64_t
+CountBits(const BigFloatView& view) noexcept {
+  const limbs::LimbSpan kLimbs = limbs::Trim(GetLimbs(view));
+  if (kLimbs.empty()) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  const auto kSize = static_cast<int64_t>(kLimbs.size());
+  return (GetExponent(view) + kSize) * kBitsPerLimb -
+         std::countl_zero(kLimbs.back());
 }
 
-size_t
-GetSize(const BigFloat& number) noexcept {
-  return big_uint::getSize(GetMantissa(number));
+uint64_t
+GetAlignedSize(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
+  const Exponent kLhsExp = GetExponent(lhs);
+  const Exponent kRhsExp = GetExponent(rhs);
+  const auto kLhsSize = static_cast<Exponent>(GetLimbs(lhs).size());
+  const auto kRhsSize = static_cast<Exponent>(GetLimbs(rhs).size());
+  const Exponent kTop = std::max(kLhsExp + kLhsSize, kRhsExp + kRhsSize);
+  return static_cast<uint64_t>(kTop - std::min(kLhsExp, kRhsExp));
 }
 
-int64_t
-CountPower(const BigFloat& number) noexcept {
-  return GetExponent(number) + static_cast<int64_t>(GetSize(number));
+std::strong_ordering
+CompareMagnitudes(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
+  const Exponent kLhsExp = GetExponent(lhs);
+  const Exponent kRhsExp = GetExponent(rhs);
+  if (kLhsExp >= kRhsExp) {
+    const auto kShift = static_cast<size_t>(kLhsExp - kRhsExp);
+    return limbs::Compare(GetLimbs(lhs), GetLimbs(rhs), kShift);
+  }
+  const auto kShift = static_cast<size_t>(kRhsExp - kLhsExp);
+  return 0 <=> limbs::Compare(GetLimbs(rhs), GetLimbs(lhs), kShift);
 }
 
 }  // namespace big_float
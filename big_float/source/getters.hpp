@@ -1,32 +1,59 @@
 #pragma once
 
+#include <compare>
 #include <cstddef>
 #include <cstdint>
 
 #include "big_float.hpp"
+#include "big_float_view.hpp"
 #include "big_uint.hpp"
+#include "error.hpp"
 #include "exponent.hpp"
+#include "limbs.hpp"
+#include "sign.hpp"
 #include "type.hpp"
 
 namespace big_float {
 
-Type
-GetType(const BigFloat& number) noexcept;
+// The accessors below run on every arithmetic call; they live here so that
+// they inline even when the library is built without LTO.
 
-bool
-IsSpecial(const BigFloat& number) noexcept;
+inline constexpr Type
+GetType(const BigFloat& number) noexcept {
+  return static_cast<Type>(GetHeader(number) & kTypeMask);
+}
 
-bool
-GetSign(const BigFloat& number) noexcept;
+inline constexpr bool
+IsSpecial(const BigFloat& number) noexcept {
+  return (GetHeader(number) & kTypeMask) != 0;
+}
 
-bool
-IsNegative(const BigFloat& number) noexcept;
+inline constexpr bool
+IsNegative(const BigFloat& number) noexcept {
+  return (GetHeader(number) & kSignMask) != 0;
+}
 
-const big_uint::BigUInt&
-GetMantissa(const BigFloat& number) noexcept;
+// Finite, non-zero and positive: one mask compare on the header.
+inline constexpr bool
+IsDefaultPositive(const BigFloat& number) noexcept {
+  return (GetHeader(number) & (kTypeMask | kSignMask)) == 0;
+}
 
-Exponent
-GetExponent(const BigFloat& number) noexcept;
+// Either operand is zero, infinite or NaN.
+inline constexpr bool
+HasSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+  return ((GetHeader(lhs) | GetHeader(rhs)) & kTypeMask) != 0;
+}
+
+inline constexpr const big_uint::BigUInt&
+GetMantissa(const BigFloat& number) noexcept {
+  return number.number;
+}
+
+inline constexpr Exponent
+GetExponent(const BigFloat& number) noexcept {
+  return static_cast<Exponent>(number.exp_and_header) >> kHeaderBits;
+}
 
 size_t
 GetSize(const BigFloat& number) noexcept;
@@ -34,4 +61,62 @@ GetSize(const BigFloat& number) noexcept;
 int64_t
 CountPower(const BigFloat& number) noexcept;
 
+inline limbs::LimbSpan
+GetLimbs(const BigFloat& number) noexcept {
+  return GetMantissa(number).limbs;
+}
+
+inline constexpr Type
+GetType(const BigFloatView& view) noexcept {
+  return view.type;
+}
+
+inline constexpr bool
+IsSpecial(const BigFloatView& view) noexcept {
+  return GetType(view) != Type::kDefault;
+}
+
+inline constexpr Sign
+GetSign(const BigFloatView& view) noexcept {
+  return view.sign;
+}
+
+inline constexpr bool
+IsNegative(const BigFloatView& view) noexcept {
+  return IsNegative(GetSign(view));
+}
+
+inline constexpr limbs::LimbSpan
+GetLimbs(const BigFloatView& view) noexcept {
+  return view.limbs;
+}
+
+inline constexpr Exponent
+GetExponent(const BigFloatView& view) noexcept {
+  return view.exp;
+}
+
+inline constexpr const Error&
+GetError(const BigFloatView& view) noexcept {
+  return view.error;
+}
+
+int64_t
+CountPower(const BigFloatView& view) noexcept;
+
+// Bit position just above the leading one bit: exact, unlike CountPower.
+int64_t
+CountBits(const BigFloatView& view) noexcept;
+
+std::strong_ordering
+CompareMagnitudes(const BigFloatView& lhs, const BigFloatView& rhs) noexcept;
+
+// Limbs spanned by both mantissas once aligned to the lower exponent: the
+// size of their sum before the carry limb.
+uint64_t
+GetAlignedSize(const BigFloatView& lhs, const BigFloatView& rhs) noexcept;
+
+BigFloat
+ToBigFloat(BigFloat number) noexcept;
+
 }  // namespace big_float
@@ -0,0 +1,206 @@
+#include <array>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "getters.hpp"
+#include "interval.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr int64_t kErrorUlpBits = 2;
+
+BigFloat
+GetUlp(const BigFloat& number, Precision precision) noexcept {
+  return MakeScaled(
+      1, GetLeadingBit(number) + 1 - static_cast<int64_t>(precision));
+}
+
+// Truncation goes toward zero, so it already rounds one way; the other
+// direction adds one ulp of the truncated value when it was inexact.
+BigFloat
+RoundAway(const BigFloat& number, const BigFloat& truncated, bool is_up,
+          Precision precision) noexcept {
+  const bool kIsTowardZero = IsNegative(number) == is_up;
+  if (IsSpecial(number) || kIsTowardZero || IsEqual(truncated, number)) {
+    return truncated;
+  }
+  const BigFloat kUlp = GetUlp(truncated, precision);
+  return is_up ? Add(truncated, kUlp) : Sub(truncated, kUlp);
+}
+
+// Both directed roundings of one exact value share a single truncation.
+BigInterval
+RoundPoint(const BigFloat& exact, Precision precision) noexcept {
+  const BigFloat kTruncated = Truncate(exact, precision);
+  return {.lower = RoundAway(exact, kTruncated, false, precision),
+          .upper = RoundAway(exact, kTruncated, true, precision)};
+}
+
+BigInterval
+RoundOutward(const BigFloat& lower, const BigFloat& upper,
+             Precision precision) noexcept {
+  const BigFloat kLower = Truncate(lower, precision);
+  const BigFloat kUpper = Truncate(upper, precision);
+  return {.lower = RoundAway(lower, kLower, false, precision),
+          .upper = RoundAway(upper, kUpper, true, precision)};
+}
+
+// [a - e, a + e] for an approximation within 4 ulps at `working` bits.
+BigInterval
+Enclose(const BigFloat& approximation, Precision working,
+        Precision precision) noexcept {
+  if (IsSpecial(approximation)) {
+    return RoundPoint(approximation, precision);
+  }
+  const BigFloat kError =
+      Scale(GetUlp(approximation, working), kErrorUlpBits);
+  return RoundOutward(Sub(approximation, kError), Add(approximation, kError),
+                      precision);
+}
+
+const BigFloat&
+GetMin(const BigFloat& left, const BigFloat& right) noexcept {
+  return IsLower(right, left) ? right : left;
+}
+
+const BigFloat&
+GetMax(const BigFloat& left, const BigFloat& right) noexcept {
+  return IsGreater(right, left) ? right : left;
+}
+
+BigInterval
+MakeEntire() noexcept {
+  return {.lower = MakeInf(GetNegative()), .upper = MakeInf()};
+}
+
+}  // namespace
+
+BigInterval
+MakeInterval(const BigFloat& point) noexcept {
+  return {.lower = point, .upper = point};
+}
+
+BigInterval
+MakeInterval(const BigFloat& lower, const BigFloat& upper) noexcept {
+  return {.lower = lower, .upper = upper};
+}
+
+bool
+IsPoint(const BigInterval& interval) noexcept {
+  return IsEqual(interval.lower, interval.upper);
+}
+
+bool
+Contains(const BigInterval& interval, const BigFloat& value) noexcept {
+  return !IsLower(value, interval.lower) && !IsGreater(value, interval.upper);
+}
+
+BigFloat
+GetWidth(const BigInterval& interval) noexcept {
+  return Sub(interval.upper, interval.lower);
+}
+
+bool
+IsCertainlyLower(const BigInterval& left, const BigInterval& right) noexcept {
+  return IsLower(left.upper, right.lower);
+}
+
+bool
+IsCertainlyGreater(const BigInterval& left,
+                   const BigInterval& right) noexcept {
+  return IsGreater(left.lower, right.upper);
+}
+
+bool
+IsPossiblyEqual(const BigInterval& left, const BigInterval& right) noexcept {
+  return !IsCertainlyLower(left, right) && !IsCertainlyGreater(left, right);
+}
+
+BigInterval
+Add(const BigInterval& augend, const BigInterval& addend,
+    Precision precision) noexcept {
+  const BigFloat kLower = Add(augend.lower, addend.lower);
+  if (IsPoint(augend) && IsPoint(addend)) {
+    return RoundPoint(kLower, precision);
+  }
+  return RoundOutward(kLower, Add(augend.upper, addend.upper), precision);
+}
+
+BigInterval
+Sub(const BigInterval& minuend, const BigInterval& subtrahend,
+    Precision precision) noexcept {
+  const BigFloat kLower = Sub(minuend.lower, subtrahend.upper);
+  if (IsPoint(minuend) && IsPoint(subtrahend)) {
+    return RoundPoint(kLower, precision);
+  }
+  return RoundOutward(kLower, Sub(minuend.upper, subtrahend.lower),
+                      precision);
+}
+
+BigInterval
+Mul(const BigInterval& multiplicand, const BigInterval& multiplier,
+    Precision precision) noexcept {
+  const BigFloat kFirst = Mul(multiplicand.lower, multiplier.lower);
+  if (IsPoint(multiplicand) && IsPoint(multiplier)) {
+    return RoundPoint(kFirst, precision);
+  }
+  const std::array<BigFloat, 3> kOthers = {
+      Mul(multiplicand.lower, multiplier.upper),
+      Mul(multiplicand.upper, multiplier.lower),
+      Mul(multiplicand.upper, multiplier.upper)};
+  const BigFloat* lower = &kFirst;
+  const BigFloat* upper = &kFirst;
+  for (const BigFloat& product : kOthers) {
+    lower = &GetMin(*lower, product);
+    upper = &GetMax(*upper, product);
+  }
+  return RoundOutward(*lower, *upper, precision);
+}
+
+// x / [c, d] = x * [1 / d, 1 / c]: two reciprocals instead of four
+// quotients, and the products are exact.
+BigInterval
+Div(const BigInterval& dividend, const BigInterval& divisor,
+    Precision precision) noexcept {
+  if (!IsGreater(divisor.lower, MakeZero()) &&
+      !IsLower(divisor.upper, MakeZero())) {
+    return MakeEntire();
+  }
+  const Precision kWorking = precision + kGuardBits;
+  const BigFloat kOne = MakeInteger(1);
+  const BigInterval kFromUpper =
+      Enclose(Div(kOne, divisor.upper, kWorking), kWorking, kWorking);
+  const BigInterval kReciprocal =
+      IsPoint(divisor)
+          ? kFromUpper
+          : MakeInterval(kFromUpper.lower,
+                         Enclose(Div(kOne, divisor.lower, kWorking), kWorking,
+                                 kWorking)
+                             .upper);
+  return Mul(dividend, kReciprocal, precision);
+}
+
+BigInterval
+Sqrt(const BigInterval& operand, Precision precision) noexcept {
+  if (IsLower(operand.upper, MakeZero())) {
+    return MakeInterval(MakeNan());
+  }
+  const Precision kWorking = precision + kGuardBits;
+  const BigInterval kUpper =
+      Enclose(Sqrt(operand.upper, kWorking), kWorking, precision);
+  if (IsPoint(operand)) {
+    return kUpper;
+  }
+  const BigFloat kLower =
+      IsGreater(operand.lower, MakeZero())
+          ? Enclose(Sqrt(operand.lower, kWorking), kWorking, precision).lower
+          : MakeZero();
+  return {.lower = kLower, .upper = kUpper.upper};
+}
+
+}  // namespace big_float
@@ -0,0 +1,58 @@
+#include "io.hpp"
+
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unistd.h>
+
+namespace big_float::io {
+namespace {
+
+constexpr uint64_t kChecksumSeed = 0x243F6A8885A308D3;
+constexpr uint64_t kChecksumMultiplier = 0x9E3779B97F4A7C15;
+constexpr int kChecksumRotation = 29;
+
+}  // namespace
+
+bool
+WriteAll(int descriptor, std::span<const std::byte> bytes) noexcept {
+  while (!bytes.empty()) {
+    const ssize_t kWritten = ::write(descriptor, bytes.data(), bytes.size());
+    if (kWritten < 0 && errno == EINTR) {
+      continue;
+    }
+    if (kWritten <= 0) {
+      return false;
+    }
+    bytes = bytes.subspan(static_cast<size_t>(kWritten));
+  }
+  return true;
+}
+
+bool
+ReadAll(int descriptor, std::span<std::byte> bytes) noexcept {
+  while (!bytes.empty()) {
+    const ssize_t kRead = ::read(descriptor, bytes.data(), bytes.size());
+    if (kRead < 0 && errno == EINTR) {
+      continue;
+    }
+    if (kRead <= 0) {
+      return false;
+    }
+    bytes = bytes.subspan(static_cast<size_t>(kRead));
+  }
+  return true;
+}
+
+uint64_t
+Checksum(std::span<const uint64_t> words) noexcept {
+  uint64_t hash = kChecksumSeed ^ words.size();
+  for (const uint64_t kWord : words) {
+    hash = std::rotl(hash ^ kWord, kChecksumRotation) * kChecksumMultiplier;
+  }
+  return hash;
+}
+
+}  // namespace big_float::io
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace big_float::io {
+
+bool
+WriteAll(int descriptor, std::span<const std::byte> bytes) noexcept;
+
+bool
+ReadAll(int descriptor, std::span<std::byte> bytes) noexcept;
+
+uint64_t
+Checksum(std::span<const uint64_t> words) noexcept;
+
+}  // namespace big_float::io
@@ -0,0 +1,70 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr int64_t kBitsPerLimb = 64;
+
+}  // namespace
+
+BigFloat
+Ldexp(const BigFloat& number, int64_t bit_exponent) noexcept {
+  return Ldexp(BigFloat(number), bit_exponent);
+}
+
+BigFloat
+Ldexp(BigFloat&& number, int64_t bit_exponent) noexcept {
+  if (IsSpecial(number)) {
+    return std::move(number);
+  }
+  const int64_t kBits =
+      ((bit_exponent % kBitsPerLimb) + kBitsPerLimb) % kBitsPerLimb;
+  const Exponent kLimbShift = (bit_exponent - kBits) / kBitsPerLimb;
+  const Exponent kExponent = GetExponent(number) + kLimbShift;
+  if (kExponent > kMaxExponent) {
+    return MakeInf(GetSign(number), GetError(number));
+  }
+  if (kExponent < kMinExponent) {
+    return MakeZero(GetSign(number), GetError(number));
+  }
+  if (kBits != 0) {
+    number.number.limbs =
+        limbs::ShiftLeft(GetLimbs(number), static_cast<size_t>(kBits));
+  }
+  return MakeBigFloat(std::move(number.number), kExponent, GetSign(number),
+                      GetType(number), GetError(number));
+}
+
+Decomposition
+Frexp(const BigFloat& number) noexcept {
+  if (IsSpecial(number)) {
+    return {.fraction = number, .exponent = 0};
+  }
+  const int64_t kExponent = GetLeadingBit(number) + 1;
+  return {.fraction = Ldexp(number, -kExponent), .exponent = kExponent};
+}
+
+int64_t
+Ilogb(const BigFloat& number) noexcept {
+  switch (GetType(number)) {
+    case Type::kZero:
+      return kIlogbZero;
+    case Type::kInf:
+      return kIlogbInf;
+    case Type::kNan:
+      return kIlogbNan;
+    case Type::kDefault:
+      return GetLeadingBit(number);
+  }
+}
+
+}  // namespace big_float
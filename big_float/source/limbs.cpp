@@ -0,0 +1,514 @@
+#include "limbs.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace big_float::limbs {
+namespace {
+
+__extension__ using Wide = unsigned __int128;
+
+constexpr size_t kLimbBits = 64;
+constexpr size_t kKaratsubaThreshold = 32;
+
+Limb
+AddInto(std::span<Limb> accumulator, LimbSpan addend) noexcept {
+  Limb carry = 0;
+  size_t index = 0;
+  for (; index < addend.size(); ++index) {
+    const Limb kPartial = accumulator[index] + addend[index];
+    const Limb kSum = kPartial + carry;
+    carry = static_cast<Limb>(kPartial < addend[index]) |
+            static_cast<Limb>(kSum < kPartial);
+    accumulator[index] = kSum;
+  }
+  for (; carry != 0 && index < accumulator.size(); ++index) {
+    accumulator[index] += 1;
+    carry = static_cast<Limb>(accumulator[index] == 0);
+  }
+  return carry;
+}
+
+Limb
+SubInto(std::span<Limb> accumulator, LimbSpan subtrahend) noexcept {
+  Limb borrow = 0;
+  size_t index = 0;
+  for (; index < subtrahend.size(); ++index) {
+    const Limb kMinuend = accumulator[index];
+    const Limb kPartial = kMinuend - subtrahend[index];
+    const Limb kDifference = kPartial - borrow;
+    borrow = static_cast<Limb>(kMinuend < subtrahend[index]) |
+             static_cast<Limb>(kPartial < borrow);
+    accumulator[index] = kDifference;
+  }
+  for (; borrow != 0 && index < accumulator.size(); ++index) {
+    borrow = static_cast<Limb>(accumulator[index] == 0);
+    accumulator[index] -= 1;
+  }
+  return borrow;
+}
+
+void
+Normalize(Limbs& number) noexcept {
+  number.resize(Trim(number).size());
+  if (number.empty()) {
+    number.push_back(0);
+  }
+}
+
+void
+MulSchoolbook(LimbSpan lhs, LimbSpan rhs, std::span<Limb> product) noexcept {
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    Wide carry = 0;
+    for (size_t j = 0; j < rhs.size(); ++j) {
+      carry += static_cast<Wide>(lhs[i]) * rhs[j] + product[i + j];
+      product[i + j] = static_cast<Limb>(carry);
+      carry >>= kLimbBits;
+    }
+    product[i + rhs.size()] = static_cast<Limb>(carry);
+  }
+}
+
+void
+MulInto(LimbSpan lhs, LimbSpan rhs, std::span<Limb> product) noexcept {
+  if (lhs.size() < rhs.size()) {
+    std::swap(lhs, rhs);
+  }
+  if (rhs.size() < kKaratsubaThreshold) {
+    MulSchoolbook(lhs, rhs, product);
+    return;
+  }
+
+  const size_t kHalf = (lhs.size() + 1) / 2;
+  if (rhs.size() <= kHalf) {
+    Limbs partial(2 * rhs.size());
+    for (size_t offset = 0; offset < lhs.size(); offset += rhs.size()) {
+      const LimbSpan kChunk =
+          lhs.subspan(offset, std::min(rhs.size(), lhs.size() - offset));
+      std::fill(partial.begin(), partial.end(), 0);
+      const size_t kPartialSize = kChunk.size() + rhs.size();
+      MulInto(kChunk, rhs, std::span(partial).first(kPartialSize));
+      AddInto(product.subspan(offset), Trim(partial));
+    }
+    return;
+  }
+
+  const LimbSpan kLhsLow = lhs.first(kHalf);
+  const LimbSpan kLhsHigh = lhs.subspan(kHalf);
+  const LimbSpan kRhsLow = rhs.first(kHalf);
+  const LimbSpan kRhsHigh = rhs.subspan(kHalf);
+
+  const std::span<Limb> kLow = product.first(2 * kHalf);
+  const std::span<Limb> kHigh = product.subspan(2 * kHalf);
+  MulInto(kLhsLow, kRhsLow, kLow);
+  MulInto(kLhsHigh, kRhsHigh, kHigh);
+
+  const Limbs kLhsSum = Add(kLhsLow, kLhsHigh);
+  const Limbs kRhsSum = Add(kRhsLow, kRhsHigh);
+  Limbs middle(kLhsSum.size() + kRhsSum.size());
+  MulInto(kLhsSum, kRhsSum, middle);
+  SubInto(middle, Trim(kLow));
+  SubInto(middle, Trim(kHigh));
+  AddInto(product.subspan(kHalf), Trim(middle));
+}
+
+// Each cross product a_i a_j with i < j is formed once, the sum is doubled
+// by a one-bit shift and the squares a_i^2 are added on the diagonal, which
+// saves about half of the limb products. `product` must be zeroed.
+void
+SqrSchoolbook(LimbSpan number, std::span<Limb> product) noexcept {
+  const size_t kSize = number.size();
+  for (size_t i = 0; i + 1 < kSize; ++i) {
+    Wide carry = 0;
+    for (size_t j = i + 1; j < kSize; ++j) {
+      carry += static_cast<Wide>(number[i]) * number[j] + product[i + j];
+      product[i + j] = static_cast<Limb>(carry);
+      carry >>= kLimbBits;
+    }
+    product[i + kSize] = static_cast<Limb>(carry);
+  }
+
+  Limb shifted_out = 0;
+  Limb carry = 0;
+  for (size_t i = 0; i < kSize; ++i) {
+    const Limb kLow = product[2 * i];
+    const Limb kHigh = product[2 * i + 1];
+    const Wide kSquare = static_cast<Wide>(number[i]) * number[i];
+    Wide sum = Wide{(kLow << 1) | shifted_out} +
+               static_cast<Limb>(kSquare) + carry;
+    product[2 * i] = static_cast<Limb>(sum);
+    sum = Wide{(kHigh << 1) | (kLow >> (kLimbBits - 1))} +
+          static_cast<Limb>(kSquare >> kLimbBits) +
+          static_cast<Limb>(sum >> kLimbBits);
+    product[2 * i + 1] = static_cast<Limb>(sum);
+    shifted_out = kHigh >> (kLimbBits - 1);
+    carry = static_cast<Limb>(sum >> kLimbBits);
+  }
+}
+
+// Karatsuba with one operand: (l + h)^2 - l^2 - h^2 gives the middle term,
+// so all three recursive products are squares again.
+void
+SqrInto(LimbSpan number, std::span<Limb> product) noexcept {
+  if (number.size() < kKaratsubaThreshold) {
+    SqrSchoolbook(number, product);
+    return;
+  }
+
+  const size_t kHalf = (number.size() + 1) / 2;
+  const LimbSpan kNumberLow = number.first(kHalf);
+  const LimbSpan kNumberHigh = number.subspan(kHalf);
+
+  const std::span<Limb> kLow = product.first(2 * kHalf);
+  const std::span<Limb> kHigh = product.subspan(2 * kHalf);
+  SqrInto(kNumberLow, kLow);
+  SqrInto(kNumberHigh, kHigh);
+
+  const Limbs kSum = Add(kNumberLow, kNumberHigh);
+  Limbs middle(2 * kSum.size());
+  SqrInto(kSum, middle);
+  SubInto(middle, Trim(kLow));
+  SubInto(middle, Trim(kHigh));
+  AddInto(product.subspan(kHalf), Trim(middle));
+}
+
+Limbs
+ShiftBitsLeft(LimbSpan number, size_t shift, size_t extra_limbs) noexcept {
+  Limbs result(number.size() + extra_limbs);
+  Limb carry = 0;
+  for (size_t index = 0; index < number.size(); ++index) {
+    result[index] = (number[index] << shift) | carry;
+    carry = shift == 0 ? 0 : number[index] >> (kLimbBits - shift);
+  }
+  if (extra_limbs > 0) {
+    result[number.size()] = carry;
+  }
+  return result;
+}
+
+Limbs
+ShiftBitsRight(LimbSpan number, size_t shift) noexcept {
+  Limbs result(number.size());
+  for (size_t index = 0; index < number.size(); ++index) {
+    const Limb kHigh = index + 1 < number.size() ? number[index + 1] : 0;
+    result[index] = number[index] >> shift;
+    if (shift != 0) {
+      result[index] |= kHigh << (kLimbBits - shift);
+    }
+  }
+  return result;
+}
+
+// Divisor shifted so that its top bit is set, with the reciprocal
+// floor((2^128 - 1) / divisor) - 2^64 of Moller and Granlund, "Improved
+// division by invariant integers", so that every step below is one
+// multiplication instead of a 128-by-64 division.
+struct LimbInverse {  // NOLINT
+  Limb divisor;
+  Limb inverse;
+  size_t shift;
+};
+
+LimbInverse
+MakeLimbInverse(Limb denominator) noexcept {
+  const auto kShift = static_cast<size_t>(std::countl_zero(denominator));
+  const Limb kDivisor = denominator << kShift;
+  const Wide kInverse = ~Wide{0} / kDivisor;
+  return {.divisor = kDivisor,
+          .inverse = static_cast<Limb>(kInverse),
+          .shift = kShift};
+}
+
+// Quotient of (remainder * 2^64 + low) / divisor for remainder < divisor;
+// the new remainder replaces `remainder`.
+Limb
+DivStep(Limb& remainder, Limb low, const LimbInverse& inverse) noexcept {
+  const Wide kProduct = Wide{inverse.inverse} * remainder +
+                        ((Wide{remainder} << kLimbBits) | low);
+  auto quotient = static_cast<Limb>(kProduct >> kLimbBits) + 1;
+  Limb rest = low - quotient * inverse.divisor;
+  if (rest > static_cast<Limb>(kProduct)) {
+    quotient -= 1;
+    rest += inverse.divisor;
+  }
+  if (rest >= inverse.divisor) {
+    quotient += 1;
+    rest -= inverse.divisor;
+  }
+  remainder = rest;
+  return quotient;
+}
+
+// numerator * B^extra_limbs / denominator; the result holds the quotient and
+// the remainder is returned.
+Limb
+DivLimbInto(LimbSpan numerator, Limb denominator, size_t extra_limbs,
+            std::span<Limb> quotient) noexcept {
+  const LimbInverse kInverse = MakeLimbInverse(denominator);
+  const size_t kShift = kInverse.shift;
+  const auto kNormalized = [numerator, kShift](size_t index) {
+    const Limb kLow = index > 0 ? numerator[index - 1] : 0;
+    return kShift == 0 ? numerator[index]
+                       : (numerator[index] << kShift) |
+                             (kLow >> (kLimbBits - kShift));
+  };
+  Limb remainder =
+      kShift == 0 ? 0 : numerator.back() >> (kLimbBits - kShift);
+  for (size_t index = numerator.size(); index-- > 0;) {
+    quotient[index + extra_limbs] =
+        DivStep(remainder, kNormalized(index), kInverse);
+  }
+  for (size_t index = extra_limbs; index-- > 0;) {
+    quotient[index] = DivStep(remainder, 0, kInverse);
+  }
+  return remainder >> kShift;
+}
+
+Division
+DivModLimb(LimbSpan numerator, Limb denominator) noexcept {
+  Limbs quotient(numerator.size());
+  const Limb kRemainder = DivLimbInto(numerator, denominator, 0, quotient);
+  Normalize(quotient);
+  return {.quotient = std::move(quotient), .remainder = {kRemainder}};
+}
+
+// Knuth, TAOCP vol. 2, 4.3.1, algorithm D.
+Division
+DivModKnuth(LimbSpan numerator, LimbSpan denominator) noexcept {
+  const auto kShift =
+      static_cast<size_t>(std::countl_zero(denominator.back()));
+  const Limbs kDivisor = ShiftBitsLeft(denominator, kShift, 0);
+  Limbs dividend = ShiftBitsLeft(numerator, kShift, 1);
+
+  const size_t kDivisorSize = kDivisor.size();
+  const Limb kTop = kDivisor[kDivisorSize - 1];
+  const Limb kNext = kDivisor[kDivisorSize - 2];
+  Limbs quotient(numerator.size() - kDivisorSize + 1);
+
+  for (size_t j = quotient.size(); j-- > 0;) {
+    const Wide kHead =
+        (static_cast<Wide>(dividend[j + kDivisorSize]) << kLimbBits) |
+        dividend[j + kDivisorSize - 1];
+    Wide estimate = kHead / kTop;
+    Wide rest = kHead % kTop;
+    while (estimate >> kLimbBits != 0 ||
+           estimate * kNext >
+               ((rest << kLimbBits) | dividend[j + kDivisorSize - 2])) {
+      --estimate;
+      rest += kTop;
+      if (rest >> kLimbBits != 0) {
+        break;
+      }
+    }
+
+    Limb carry = 0;
+    Limb borrow = 0;
+    for (size_t i = 0; i < kDivisorSize; ++i) {
+      const Wide kProduct = static_cast<Wide>(kDivisor[i]) * estimate + carry;
+      carry = static_cast<Limb>(kProduct >> kLimbBits);
+      const Limb kLow = static_cast<Limb>(kProduct);
+      const Limb kMinuend = dividend[i + j];
+      const Limb kDifference = kMinuend - kLow - borrow;
+      borrow = static_cast<Limb>(kMinuend < kLow) |
+               static_cast<Limb>(kMinuend - kLow < borrow);
+      dividend[i + j] = kDifference;
+    }
+    const Limb kMinuend = dividend[j + kDivisorSize];
+    dividend[j + kDivisorSize] = kMinuend - carry - borrow;
+    const bool kIsNegative = kMinuend < carry ||
+                             kMinuend - carry < borrow;
+
+    if (kIsNegative) {
+      --estimate;
+      const std::span<Limb> kWindow =
+          std::span(dividend).subspan(j, kDivisorSize + 1);
+      AddInto(kWindow, kDivisor);
+    }
+    quotient[j] = static_cast<Limb>(estimate);
+  }
+
+  Limbs remainder =
+      ShiftBitsRight(std::span(dividend).first(kDivisorSize), kShift);
+  Normalize(quotient);
+  Normalize(remainder);
+  return {.quotient = std::move(quotient), .remainder = std::move(remainder)};
+}
+
+}  // namespace
+
+LimbSpan
+Trim(LimbSpan number) noexcept {
+  size_t size = number.size();
+  while (size > 0 && number[size - 1] == 0) {
+    --size;
+  }
+  return number.first(size);
+}
+
+bool
+IsZero(LimbSpan number) noexcept {
+  return Trim(number).empty();
+}
+
+std::strong_ordering
+Compare(LimbSpan lhs, LimbSpan rhs, size_t shift) noexcept {
+  lhs = Trim(lhs);
+  rhs = Trim(rhs);
+  if (lhs.empty() || rhs.empty()) {
+    return !lhs.empty() <=> !rhs.empty();
+  }
+  if (lhs.size() + shift != rhs.size()) {
+    return lhs.size() + shift <=> rhs.size();
+  }
+  for (size_t index = rhs.size(); index-- > shift;) {
+    if (lhs[index - shift] != rhs[index]) {
+      return lhs[index - shift] <=> rhs[index];
+    }
+  }
+  return IsZero(rhs.first(shift)) ? std::strong_ordering::equal
+                                  : std::strong_ordering::less;
+}
+
+Limbs
+Add(LimbSpan lhs, LimbSpan rhs, size_t shift) noexcept {
+  lhs = Trim(lhs);
+  rhs = Trim(rhs);
+  Limbs result(std::max(lhs.size() + shift, rhs.size()) + 1);
+  std::copy(rhs.begin(), rhs.end(), result.begin());
+  AddInto(std::span(result).subspan(shift), lhs);
+  Normalize(result);
+  return result;
+}
+
+Difference
+SubMagnitudes(LimbSpan lhs, size_t lhs_shift, LimbSpan rhs,
+              size_t rhs_shift) noexcept {
+  lhs = Trim(lhs);
+  rhs = Trim(rhs);
+  const auto kLhsAt = [lhs, lhs_shift](size_t position) {
+    return position >= lhs_shift && position - lhs_shift < lhs.size()
+               ? lhs[position - lhs_shift]
+               : Limb{0};
+  };
+  const auto kRhsAt = [rhs, rhs_shift](size_t position) {
+    return position >= rhs_shift && position - rhs_shift < rhs.size()
+               ? rhs[position - rhs_shift]
+               : Limb{0};
+  };
+
+  // Trimmed operands have a non-zero top limb, so unequal lengths decide
+  // the order; otherwise the first differing limb from the top does, and
+  // the limbs above it cancel.
+  const size_t kLhsTop = lhs.empty() ? 0 : lhs.size() + lhs_shift;
+  const size_t kRhsTop = rhs.empty() ? 0 : rhs.size() + rhs_shift;
+  size_t size = std::max(kLhsTop, kRhsTop);
+  std::strong_ordering order = kLhsTop <=> kRhsTop;
+  while (order == std::strong_ordering::equal && size > 0) {
+    --size;
+    order = kLhsAt(size) <=> kRhsAt(size);
+    if (order != std::strong_ordering::equal) {
+      ++size;
+    }
+  }
+  if (order == std::strong_ordering::equal) {
+    return {.magnitude = {0}, .order = order};
+  }
+
+  const bool kIsLhsLarger = order == std::strong_ordering::greater;
+  Limbs magnitude(size);
+  Limb borrow = 0;
+  for (size_t position = 0; position < size; ++position) {
+    const Limb kLarger = kIsLhsLarger ? kLhsAt(position) : kRhsAt(position);
+    const Limb kSmaller = kIsLhsLarger ? kRhsAt(position) : kLhsAt(position);
+    const Limb kPartial = kLarger - kSmaller;
+    magnitude[position] = kPartial - borrow;
+    borrow = static_cast<Limb>(kLarger < kSmaller) |
+             static_cast<Limb>(kPartial < borrow);
+  }
+  Normalize(magnitude);
+  return {.magnitude = std::move(magnitude), .order = order};
+}
+
+Limbs
+Mul(LimbSpan lhs, LimbSpan rhs) noexcept {
+  lhs = Trim(lhs);
+  rhs = Trim(rhs);
+  Limbs result(lhs.size() + rhs.size());
+  MulInto(lhs, rhs, result);
+  Normalize(result);
+  return result;
+}
+
+Limb
+MulAdd(LimbSpan lhs, LimbSpan rhs, std::span<Limb> accumulator) noexcept {
+  lhs = Trim(lhs);
+  rhs = Trim(rhs);
+  Limbs product(lhs.size() + rhs.size());
+  MulInto(lhs, rhs, product);
+  return AddInto(accumulator, Trim(product));
+}
+
+Limbs
+Sqr(LimbSpan number) noexcept {
+  number = Trim(number);
+  Limbs result(2 * number.size());
+  SqrInto(number, result);
+  Normalize(result);
+  return result;
+}
+
+Limbs
+MulLimb(LimbSpan number, Limb factor) noexcept {
+  Limbs result(number.size() + 1);
+  Limb carry = 0;
+  for (size_t index = 0; index < number.size(); ++index) {
+    const Wide kProduct = Wide{number[index]} * factor + carry;
+    result[index] = static_cast<Limb>(kProduct);
+    carry = static_cast<Limb>(kProduct >> kLimbBits);
+  }
+  result.back() = carry;
+  Normalize(result);
+  return result;
+}
+
+Limbs
+DivLimb(LimbSpan numerator, Limb denominator, size_t extra_limbs) noexcept {
+  numerator = Trim(numerator);
+  if (numerator.empty()) {
+    return {0};
+  }
+  Limbs quotient(numerator.size() + extra_limbs);
+  DivLimbInto(numerator, denominator, extra_limbs, quotient);
+  Normalize(quotient);
+  return quotient;
+}
+
+Limbs
+ShiftLeft(LimbSpan number, size_t bits) noexcept {
+  Limbs result = ShiftBitsLeft(number, bits, 1);
+  if (result.back() == 0) {
+    result.pop_back();
+  }
+  return result;
+}
+
+Division
+DivMod(LimbSpan numerator, LimbSpan denominator) noexcept {
+  numerator = Trim(numerator);
+  denominator = Trim(denominator);
+  if (numerator.size() < denominator.size()) {
+    Limbs remainder(numerator.begin(), numerator.end());
+    Normalize(remainder);
+    return {.quotient = {0}, .remainder = std::move(remainder)};
+  }
+  if (denominator.size() == 1) {
+    return DivModLimb(numerator, denominator[0]);
+  }
+  return DivModKnuth(numerator, denominator);
+}
+
+}  // namespace big_float::limbs
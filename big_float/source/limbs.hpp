@@ -0,0 +1,75 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace big_float::limbs {
+
+using Limb = uint64_t;
+using Limbs = std::vector<Limb>;
+using LimbSpan = std::span<const Limb>;
+
+// All kernels treat spans as little-endian magnitudes; `shift` is counted in
+// limbs and scales the left operand, so `Add(lhs, rhs, s)` is lhs * B^s + rhs.
+
+LimbSpan
+Trim(LimbSpan number) noexcept;
+
+bool
+IsZero(LimbSpan number) noexcept;
+
+std::strong_ordering
+Compare(LimbSpan lhs, LimbSpan rhs, size_t shift = 0) noexcept;
+
+Limbs
+Add(LimbSpan lhs, LimbSpan rhs, size_t shift = 0) noexcept;
+
+struct Difference {  // NOLINT
+  Limbs magnitude;
+  std::strong_ordering order;
+};
+
+// |lhs * B^lhs_shift - rhs * B^rhs_shift| and the order of the two operands
+// in a single pass: the scan from the top stops at the first differing
+// limb and the subtraction covers only the limbs below it.
+Difference
+SubMagnitudes(LimbSpan lhs, size_t lhs_shift, LimbSpan rhs,
+              size_t rhs_shift) noexcept;
+
+Limbs
+Mul(LimbSpan lhs, LimbSpan rhs) noexcept;
+
+// accumulator += lhs * rhs; returns the carry out of the top limb. The
+// accumulator needs room for the trimmed product.
+Limb
+MulAdd(LimbSpan lhs, LimbSpan rhs, std::span<Limb> accumulator) noexcept;
+
+// Mul(number, number) with the symmetric cross products computed once.
+Limbs
+Sqr(LimbSpan number) noexcept;
+
+Limbs
+MulLimb(LimbSpan number, Limb factor) noexcept;
+
+// floor(numerator * B^extra_limbs / denominator) for a non-zero denominator,
+// using a precomputed reciprocal instead of a hardware division per limb.
+Limbs
+DivLimb(LimbSpan numerator, Limb denominator, size_t extra_limbs) noexcept;
+
+// number * 2^bits for bits < 64, with the top limb dropped when it is zero.
+Limbs
+ShiftLeft(LimbSpan number, size_t bits) noexcept;
+
+struct Division {  // NOLINT
+  Limbs quotient;
+  Limbs remainder;
+};
+
+// Floor division; `denominator` must be non-zero.
+Division
+DivMod(LimbSpan numerator, LimbSpan denominator) noexcept;
+
+}  // namespace big_float::limbs
@@ -0,0 +1,77 @@
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "constants.hpp"
+#include "precision.hpp"
+#include "series.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr uint64_t kLn10Ln2Factor = 3;
+constexpr uint64_t kFiveQuartersFactor = 2;
+constexpr uint64_t kFiveQuartersInverse = 9;
+
+struct MachinTerm {  // NOLINT
+  uint64_t factor;
+  uint64_t inverse;
+  bool is_negative;
+};
+
+// ln 2 = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749).
+constexpr std::array<MachinTerm, 3> kLn2Terms = {
+    {{.factor = 18, .inverse = 26, .is_negative = false},
+     {.factor = 2, .inverse = 4801, .is_negative = true},
+     {.factor = 8, .inverse = 8749, .is_negative = false}}};
+
+// atanh(1 / q) = sum_k 1 / ((2k + 1) q^(2k + 1)).
+BigFloat
+AtanhInverse(uint64_t q, Precision precision) noexcept {
+  const BigFloat kOne = MakeInteger(1);
+  const BigFloat kQ = MakeInteger(q);
+  const BigFloat kQSquare = MakeInteger(q * q);
+  const auto kTerms = [&](uint64_t index) {
+    return SeriesTerm{.a = kOne,
+                      .b = MakeInteger(2 * index + 1),
+                      .p = kOne,
+                      .q = index == 0 ? kQ : kQSquare};
+  };
+  const uint64_t kBitsPerTerm = 2 * (std::bit_width(q) - 1);
+  return SumSeries(kTerms, precision / kBitsPerTerm + 2, precision);
+}
+
+BigFloat
+ComputeLn2Working(Precision working) noexcept {
+  BigFloat sum = MakeZero();
+  for (const MachinTerm& term : kLn2Terms) {
+    const BigFloat kTerm = Mul(MakeInteger(term.factor),
+                               AtanhInverse(term.inverse, working));
+    sum = term.is_negative ? Sub(sum, kTerm) : Add(sum, kTerm);
+  }
+  return sum;
+}
+
+}  // namespace
+
+BigFloat
+ComputeLn2(Precision precision) noexcept {
+  return Truncate(ComputeLn2Working(precision + kGuardBits), precision);
+}
+
+// ln 10 = 3 ln 2 + ln(5/4) and ln(5/4) = 2 atanh(1/9).
+BigFloat
+ComputeLn10(Precision precision) noexcept {
+  const Precision kWorking = precision + kGuardBits;
+  const BigFloat kLn2 = ComputeLn2Working(kWorking);
+  const BigFloat kLnFiveQuarters =
+      Mul(MakeInteger(kFiveQuartersFactor),
+          AtanhInverse(kFiveQuartersInverse, kWorking));
+  return Truncate(Add(Mul(MakeInteger(kLn10Ln2Factor), kLn2), kLnFiveQuarters),
+                  precision);
+}
+
+}  // namespace big_float
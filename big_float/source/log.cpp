@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "getters.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr Precision kSeedPrecision = 48;
+constexpr Precision kAgmThreshold = Precision{1} << 15;
+constexpr uint64_t kThreeHalves = 0xC000000000000000;
+constexpr uint64_t kAgmNumerator = 4;
+
+// Newton iteration z' = z + y exp(-z) - 1, doubling the working precision
+// at every step.
+BigFloat
+LogNewton(const BigFloat& mantissa, Precision working) noexcept {
+  const BigFloat kOne = MakeInteger(1);
+  const Approximation kApproximation = Approximate(mantissa);
+  BigFloat result = MakeFromDouble(
+      std::log(std::ldexp(static_cast<double>(kApproximation.top),
+                          static_cast<int>(kApproximation.bit_exponent))));
+  Precision step = kSeedPrecision;
+  while (step < working) {
+    step = std::min(2 * step, working);
+    const Precision kStep = step + kGuardBits;
+    const BigFloat kProduct =
+        Truncate(Mul(mantissa, Exp(Neg(result), kStep)), kStep);
+    result = TruncateFraction(Add(result, Sub(kProduct, kOne)),
+                              static_cast<int64_t>(kStep));
+  }
+  return result;
+}
+
+// log y = pi / (2 AGM(1, 4 / s)) - m log 2 with s = y 2^m > 2^(p / 2).
+BigFloat
+LogAgm(const BigFloat& mantissa, Precision working) noexcept {
+  const Precision kWorking = working + 2 * kGuardBits;
+  const auto kShift = static_cast<int64_t>(working / 2 + kGuardBits);
+  BigFloat arithmetic = MakeInteger(1);
+  BigFloat geometric =
+      Div(MakeInteger(kAgmNumerator), Scale(mantissa, kShift), kWorking);
+  const auto kStop = -static_cast<int64_t>(kWorking / 2);
+  while (true) {
+    const BigFloat kGap = Sub(arithmetic, geometric);
+    const bool kIsConverged = IsZero(kGap) || GetLeadingBit(kGap) < kStop;
+    const BigFloat kMean = Scale(Add(arithmetic, geometric), -1);
+    if (kIsConverged) {
+      arithmetic = Truncate(kMean, kWorking);
+      break;
+    }
+    geometric = Sqrt(Mul(arithmetic, geometric), kWorking);
+    arithmetic = Truncate(kMean, kWorking);
+  }
+
+  const BigFloat kPi = GetConstant(Constant::kPi, kWorking);
+  const BigFloat kLn2 = GetConstant(Constant::kLn2, kWorking);
+  const BigFloat kLogScaled = Div(kPi, Scale(arithmetic, 1), kWorking);
+  return Sub(kLogScaled, Mul(MakeSigned(kShift), kLn2));
+}
+
+// log x = log y + e log 2 with x = y 2^e and y in [0.75, 1.5).
+BigFloat
+LogNonSpecial(const BigFloat& operand, Precision precision) noexcept {
+  const BigFloat kOne = MakeInteger(1);
+  int64_t exponent = GetLeadingBit(operand);
+  if (Approximate(operand).top >= kThreeHalves) {
+    exponent += 1;
+  }
+  const BigFloat kMantissa = Scale(operand, -exponent);
+  const BigFloat kOffset = Sub(kMantissa, kOne);
+  if (exponent == 0 && IsZero(kOffset)) {
+    return MakeZero();
+  }
+
+  const int64_t kExtra =
+      exponent == 0 ? std::max<int64_t>(-GetLeadingBit(kOffset), 0) : 0;
+  const Precision kWorking =
+      precision + kGuardBits + static_cast<Precision>(kExtra);
+  const BigFloat kLogMantissa = kWorking >= kAgmThreshold
+                                    ? LogAgm(kMantissa, kWorking)
+                                    : LogNewton(kMantissa, kWorking);
+  if (exponent == 0) {
+    return Truncate(kLogMantissa, precision);
+  }
+
+  const BigFloat kMultiple = MakeSigned(exponent);
+  const BigFloat kLn2 =
+      GetConstant(Constant::kLn2, kWorking + GetBitWidth(kMultiple));
+  return Truncate(Add(kLogMantissa, Mul(kMultiple, kLn2)), precision);
+}
+
+BigFloat
+LogSpecial(const BigFloat& operand) noexcept {
+  switch (GetType(operand)) {
+    case Type::kNan:
+      return operand;
+    case Type::kZero:
+      return MakeInf(GetNegative());
+    case Type::kInf:
+      return IsNegative(operand) ? MakeNan() : operand;
+    case Type::kDefault:
+      return MakeNan();
+  }
+}
+
+bool
+IsPowerOfTwo(const BigFloat& operand) noexcept {
+  return !IsNegative(operand) &&
+         IsEqual(operand, MakeScaled(1, GetLeadingBit(operand)));
+}
+
+}  // namespace
+
+BigFloat
+Log(const BigFloat& operand, Precision precision) noexcept {
+  if (IsDefaultPositive(operand)) {
+    return LogNonSpecial(operand, precision);
+  }
+  return LogSpecial(operand);
+}
+
+BigFloat
+Log2(const BigFloat& operand, Precision precision) noexcept {
+  if (IsSpecial(operand)) {
+    return LogSpecial(operand);
+  }
+  if (IsPowerOfTwo(operand)) {
+    return MakeSigned(GetLeadingBit(operand));
+  }
+  const Precision kWorking = precision + kGuardBits;
+  return Div(Log(operand, kWorking), GetConstant(Constant::kLn2, kWorking),
+             precision);
+}
+
+BigFloat
+Log1p(const BigFloat& operand, Precision precision) noexcept {
+  if (IsSpecial(operand)) {
+    return IsInf(operand) && IsNegative(operand) ? MakeNan() : operand;
+  }
+  if (IsTinyForSeries(operand, precision)) {
+    return AddHalfSquare(operand, GetNegative(), precision);
+  }
+  return Log(Add(MakeInteger(1), operand), precision);
+}
+
+}  // namespace big_float
@@ -1,8 +1,14 @@
+#include <utility>
+
 #include "big_float.hpp"
+#include "big_float_view.hpp"
 #include "big_uint.hpp"
+#include "budget.hpp"
+#include "builders.hpp"
 #include "error.hpp"
 #include "exponent.hpp"
 #include "getters.hpp"
+#include "limbs.hpp"
 #include "sign.hpp"
 #include "type.hpp"
 
@@ -11,14 +17,18 @@ using big_uint::BigUInt;
 namespace big_float {
 namespace {
 
+template <typename Number>
 Sign
-GetResultSign(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+GetResultSign(const Number& lhs, const Number& rhs) noexcept {
   const bool kHasSameSign = IsEqual(GetSign(lhs), GetSign(rhs));
   return kHasSameSign ? GetPositive() : GetNegative();
 }
 
 BigFloat
 MulNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+  if (!FitsMemoryBudget(GetLimbs(lhs).size() + GetLimbs(rhs).size())) {
+    return MakeOverBudget();
+  }
   const BigUInt& lhs_mantissa = GetMantissa(lhs);
   const BigUInt& rhs_mantissa = GetMantissa(rhs);
   const Exponent kLhsExp = GetExponent(lhs);
@@ -34,11 +44,55 @@ MulNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
                       Type::kDefault, GetDefaultError());
 }
 
+// Both operands read the same limbs, as in Mul(x, x) or Mul(x, Neg(x)).
+bool
+IsSameMagnitude(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
+  const limbs::LimbSpan kLhsLimbs = GetLimbs(lhs);
+  const limbs::LimbSpan kRhsLimbs = GetLimbs(rhs);
+  return kLhsLimbs.data() == kRhsLimbs.data() &&
+         kLhsLimbs.size() == kRhsLimbs.size() &&
+         GetExponent(lhs) == GetExponent(rhs);
+}
+
+BigFloat
+SqrNonSpecial(const BigFloatView& number, Sign sign) noexcept {
+  if (!FitsMemoryBudget(2 * GetLimbs(number).size())) {
+    return MakeOverBudget();
+  }
+  BigUInt result_mantissa;
+  result_mantissa.limbs = limbs::Sqr(GetLimbs(number));
+  if (limbs::IsZero(result_mantissa.limbs)) {
+    return MakeZero(sign);
+  }
+  return MakeBigFloat(std::move(result_mantissa), 2 * GetExponent(number),
+                      sign, Type::kDefault, GetDefaultError());
+}
+
 BigFloat
-MulSpecialFromNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+MulNonSpecial(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
+  if (IsSameMagnitude(lhs, rhs)) {
+    return SqrNonSpecial(lhs, GetResultSign(lhs, rhs));
+  }
+  if (!FitsMemoryBudget(GetLimbs(lhs).size() + GetLimbs(rhs).size())) {
+    return MakeOverBudget();
+  }
+  BigUInt result_mantissa;
+  result_mantissa.limbs = limbs::Mul(GetLimbs(lhs), GetLimbs(rhs));
+  const Exponent kResultExponent = GetExponent(lhs) + GetExponent(rhs);
+  const Sign kResultSign = GetResultSign(lhs, rhs);
+  if (limbs::IsZero(result_mantissa.limbs)) {
+    return MakeZero(kResultSign);
+  }
+  return MakeBigFloat(std::move(result_mantissa), kResultExponent, kResultSign,
+                      Type::kDefault, GetDefaultError());
+}
+
+template <typename Number>
+BigFloat
+MulSpecialFromNonSpecial(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kZero:
       return MakeZero(GetResultSign(lhs, rhs));
     case Type::kInf:
@@ -48,11 +102,12 @@ MulSpecialFromNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
   }
 }
 
+template <typename Number>
 BigFloat
-MulFromZero(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+MulFromZero(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kInf:
       return MakeNan();
     case Type::kZero:
@@ -61,11 +116,12 @@ MulFromZero(const BigFloat& lhs, const BigFloat& rhs) noexcept {
   }
 }
 
+template <typename Number>
 BigFloat
-MulFromInf(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+MulFromInf(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kZero:
       return MakeNan();
     case Type::kInf:
@@ -74,11 +130,12 @@ MulFromInf(const BigFloat& lhs, const BigFloat& rhs) noexcept {
   }
 }
 
+template <typename Number>
 BigFloat
-MulSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+MulSpecial(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(lhs)) {
     case Type::kNan:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kZero:
       return MulFromZero(lhs, rhs);
     case Type::kInf:
@@ -92,10 +149,37 @@ MulSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
 
 BigFloat
 Mul(const BigFloat& multiplicand, const BigFloat& multiplier) noexcept {
+  if (&multiplicand == &multiplier) {
+    return Sqr(multiplicand);
+  }
+  if (HasSpecial(multiplicand, multiplier)) {
+    return MulSpecial(multiplicand, multiplier);
+  }
+  return MulNonSpecial(multiplicand, multiplier);
+}
+
+BigFloat
+Mul(const BigFloatView& multiplicand, const BigFloatView& multiplier) noexcept {
   if (IsSpecial(multiplicand) || IsSpecial(multiplier)) {
     return MulSpecial(multiplicand, multiplier);
   }
   return MulNonSpecial(multiplicand, multiplier);
 }
 
+BigFloat
+Sqr(const BigFloat& operand) noexcept {
+  if (IsSpecial(operand)) {
+    return MulSpecial(operand, operand);
+  }
+  return SqrNonSpecial(MakeView(operand), GetPositive());
+}
+
+BigFloat
+Sqr(const BigFloatView& operand) noexcept {
+  if (IsSpecial(operand)) {
+    return MulSpecial(operand, operand);
+  }
+  return SqrNonSpecial(operand, GetPositive());
+}
+
 }  // namespace big_float
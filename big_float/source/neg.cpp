@@ -1,15 +1,31 @@
+#include <cstdint>
+#include <utility>
+
 #include "big_float.hpp"
-#include "error.hpp"
 #include "getters.hpp"
-#include "sign.hpp"
 
 namespace big_float {
 
 BigFloat
 Neg(const BigFloat& number) noexcept {
-  const Sign kSign = Invert(GetSign(number));
-  return MakeBigFloat(GetMantissa(number), GetExponent(number), kSign,
-                      GetType(number), GetError(number));
+  return Neg(BigFloat(number));
+}
+
+BigFloat
+Neg(BigFloat&& number) noexcept {
+  number.exp_and_header ^= kSignMask;
+  return std::move(number);
+}
+
+BigFloat
+Abs(const BigFloat& number) noexcept {
+  return Abs(BigFloat(number));
+}
+
+BigFloat
+Abs(BigFloat&& number) noexcept {
+  number.exp_and_header &= ~uint64_t{kSignMask};
+  return std::move(number);
 }
 
 }  // namespace big_float
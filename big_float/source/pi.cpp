@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "builders.hpp"
+#include "checkpoint.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "executor.hpp"
+#include "precision.hpp"
+#include "restart.hpp"
+#include "saved_state.hpp"
+#include "sign.hpp"
+
+namespace big_float {
+namespace {
+
+// Chudnovsky: pi = 426880 sqrt(10005) Q(0, N) / T(0, N).
+constexpr uint64_t kRootRadicand = 10005;
+constexpr uint64_t kRootFactor = 426880;
+constexpr uint64_t kLinearBase = 13591409;
+constexpr uint64_t kLinearStep = 545140134;
+constexpr uint64_t kCubeFactor = 10939058860032000;  // 640320^3 / 24
+constexpr Precision kBitsPerTerm = 47;
+constexpr Precision kGuardBits = 64;
+constexpr uint64_t kParallelTerms = 64;
+constexpr uint64_t kRestartBlocks = 64;
+
+struct Split {  // NOLINT
+  BigFloat p;
+  BigFloat q;
+  BigFloat t;
+};
+
+Split
+SplitLeaf(uint64_t term) noexcept {
+  const BigFloat kLinear =
+      Add(MakeInteger(kLinearBase),
+          Mul(MakeInteger(kLinearStep), MakeInteger(term)));
+  if (term == 0) {
+    return {.p = MakeInteger(1), .q = MakeInteger(1), .t = kLinear};
+  }
+
+  const BigFloat kTerm = MakeInteger(term);
+  const BigFloat kP =
+      Mul(Mul(MakeInteger(6 * term - 5), MakeInteger(2 * term - 1)),
+          MakeInteger(6 * term - 1));
+  const BigFloat kQ =
+      Mul(Sqr(kTerm), Mul(kTerm, kCubeFactor));
+  const BigFloat kT = Mul(kP, kLinear);
+  return {.p = kP, .q = kQ, .t = term % 2 == 0 ? kT : Neg(kT)};
+}
+
+Split
+Combine(const Split& left, const Split& right) noexcept {
+  return {.p = Mul(left.p, right.p),
+          .q = Mul(left.q, right.q),
+          .t = Add(Mul(right.q, left.t), Mul(left.p, right.t))};
+}
+
+// Binary splitting over [begin, end); the two halves are independent and
+// fork while `parallelism` allows it. Once stopped, ranges collapse to their
+// first leaf so the remaining recursion costs almost nothing.
+Split
+SplitRange(uint64_t begin, uint64_t end, const Parallelism& parallelism,
+           Checkpoint* checkpoint) noexcept {
+  if (ShouldStop(checkpoint)) {
+    return SplitLeaf(begin);
+  }
+  if (end - begin == 1) {
+    Advance(checkpoint, 1);
+    return SplitLeaf(begin);
+  }
+  const uint64_t kMiddle = begin + (end - begin) / 2;
+  const Parallelism kChild = Descend(parallelism);
+  Split left;
+  Split right;
+  ForkJoin(
+      parallelism, end - begin,
+      [&] { left = SplitRange(begin, kMiddle, kChild, checkpoint); },
+      [&] { right = SplitRange(kMiddle, end, kChild, checkpoint); });
+  return ShouldStop(checkpoint) ? left : Combine(left, right);
+}
+
+Precision
+GetWorkingPrecision(Precision precision) noexcept {
+  return precision + kGuardBits;
+}
+
+uint64_t
+CountTerms(Precision precision) noexcept {
+  return GetWorkingPrecision(precision) / kBitsPerTerm + 2;
+}
+
+BigFloat
+FinishPi(const Split& split, Precision precision) noexcept {
+  const Precision kWorking = GetWorkingPrecision(precision);
+  const BigFloat kRoot = Sqrt(MakeInteger(kRootRadicand), kWorking);
+  const BigFloat kNumerator =
+      Mul(Mul(Truncate(split.q, kWorking), MakeInteger(kRootFactor)), kRoot);
+  return Div(kNumerator, Truncate(split.t, kWorking), precision);
+}
+
+// Finished subtree over `terms` consecutive terms.
+struct Node {  // NOLINT
+  Split split;
+  uint64_t terms;
+};
+
+// Merges like a binary counter: equal-sized neighbours combine at once, so
+// the stack stays logarithmic and the products stay balanced.
+void
+Push(std::vector<Node>& nodes, Node node) noexcept {
+  nodes.push_back(std::move(node));
+  while (nodes.size() >= 2 &&
+         nodes[nodes.size() - 2].terms <= nodes.back().terms) {
+    Node right = std::move(nodes.back());
+    nodes.pop_back();
+    Node& left = nodes.back();
+    left.split = Combine(left.split, right.split);
+    left.terms += right.terms;
+  }
+}
+
+Error
+SavePi(const RestartOptions& options, Precision precision, uint64_t next,
+       const std::vector<Node>& nodes) noexcept {
+  SavedState state{.kind = SavedKind::kPi,
+                   .precision = precision,
+                   .position = next,
+                   .operand = 0,
+                   .words = {}};
+  std::vector<BigFloatView> numbers;
+  for (const Node& node : nodes) {
+    state.words.push_back(node.terms);
+    numbers.insert(numbers.end(), {MakeView(node.split.p),
+                                   MakeView(node.split.q),
+                                   MakeView(node.split.t)});
+  }
+  return SaveState(options.path, state, numbers);
+}
+
+// Splits [next, terms) block by block on top of the restored `nodes`.
+BigFloat
+RunPi(Precision precision, uint64_t next, std::vector<Node> nodes,
+      const RestartOptions& options) noexcept {
+  const uint64_t kTerms = CountTerms(precision);
+  const uint64_t kBlock = std::max<uint64_t>(kTerms / kRestartBlocks, 1);
+  const Parallelism kParallelism = MakeParallelism(kParallelTerms);
+  auto saved_at = std::chrono::steady_clock::now();
+  while (next < kTerms) {
+    const uint64_t kEnd = std::min(next + kBlock, kTerms);
+    Push(nodes, {.split = SplitRange(next, kEnd, kParallelism, nullptr),
+                 .terms = kEnd - next});
+    next = kEnd;
+    if (next == kTerms) {
+      break;
+    }
+
+    const bool kIsCancelled = IsCancelled(options.token);
+    const auto kNow = std::chrono::steady_clock::now();
+    if (kIsCancelled || kNow - saved_at >= options.interval) {
+      const Error kError = SavePi(options, precision, next, nodes);
+      if (!IsOk(kError)) {
+        return MakeNan(GetPositive(), kError);
+      }
+      saved_at = kNow;
+    }
+    if (kIsCancelled) {
+      return MakeNan(GetPositive(), MakeError(ErrorCode::kCancelled));
+    }
+  }
+
+  while (nodes.size() > 1) {
+    Node right = std::move(nodes.back());
+    nodes.pop_back();
+    nodes.back().split = Combine(nodes.back().split, right.split);
+  }
+  RemoveState(options.path);
+  return FinishPi(nodes.front().split, precision);
+}
+
+}  // namespace
+
+BigFloat
+ComputePi(Precision precision) noexcept {
+  return ComputePi(precision, MakeParallelism(kParallelTerms));
+}
+
+BigFloat
+ComputePi(Precision precision, const Parallelism& parallelism) noexcept {
+  return ComputePi(precision, parallelism, nullptr);
+}
+
+BigFloat
+ComputePi(Precision precision, const Parallelism& parallelism,
+          Checkpoint* checkpoint) noexcept {
+  const uint64_t kTerms = CountTerms(precision);
+  SetTotal(checkpoint, kTerms);
+  const Split kSplit = SplitRange(0, kTerms, parallelism, checkpoint);
+  if (ShouldStop(checkpoint)) {
+    return MakeNan();
+  }
+  return FinishPi(kSplit, precision);
+}
+
+BigFloat
+ComputePi(Precision precision, const RestartOptions& options) noexcept {
+  return RunPi(precision, 0, {}, options);
+}
+
+BigFloat
+ResumePi(const RestartOptions& options) noexcept {
+  LoadedState loaded = LoadState(options.path, SavedKind::kPi);
+  if (!IsOk(loaded.error)) {
+    return MakeNan(GetPositive(), loaded.error);
+  }
+  const SavedState& state = loaded.state;
+  std::vector<BigFloat>& numbers = loaded.numbers;
+  if (numbers.size() != 3 * state.words.size()) {
+    return MakeNan(GetPositive(), MakeError(ErrorCode::kInvalidFormat));
+  }
+  uint64_t covered = 0;
+  std::vector<Node> nodes;
+  for (size_t index = 0; index < state.words.size(); ++index) {
+    covered += state.words[index];
+    nodes.push_back({.split = {.p = std::move(numbers[3 * index]),
+                               .q = std::move(numbers[3 * index + 1]),
+                               .t = std::move(numbers[3 * index + 2])},
+                     .terms = state.words[index]});
+  }
+  if (covered != state.position ||
+      state.position >= CountTerms(state.precision)) {
+    return MakeNan(GetPositive(), MakeError(ErrorCode::kInvalidFormat));
+  }
+  return RunPi(state.precision, state.position, std::move(nodes), options);
+}
+
+}  // namespace big_float
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "elementary.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr int64_t kMaxIntegerBit = 62;
+
+uint64_t
+GetMagnitude(int64_t value) noexcept {
+  const auto kValue = static_cast<uint64_t>(value);
+  return value < 0 ? 0 - kValue : kValue;
+}
+
+Sign
+GetPowerSign(const BigFloat& base, uint64_t power) noexcept {
+  return power % 2 == 0 ? GetPositive() : GetSign(base);
+}
+
+// Square-and-multiply from the top bit down. Rounding errors of early
+// squarings are amplified by the later ones, which costs about
+// log2(power) bits, so `working` must include them.
+BigFloat
+PowMagnitude(const BigFloat& base, uint64_t power, Precision working) noexcept {
+  BigFloat result = base;
+  const auto kTopBit = static_cast<int>(std::bit_width(power)) - 1;
+  for (int bit = kTopBit - 1; bit >= 0; --bit) {
+    result = Truncate(Sqr(result), working);
+    if ((power >> bit) % 2 != 0) {
+      result = Truncate(Mul(result, base), working);
+    }
+  }
+  return result;
+}
+
+BigFloat
+PowIntSpecial(const BigFloat& base, int64_t power) noexcept {
+  const Sign kSign = GetPowerSign(base, GetMagnitude(power));
+  switch (GetType(base)) {
+    case Type::kNan:
+      return base;
+    case Type::kZero:
+      return power < 0 ? MakeInf(kSign) : MakeZero(kSign);
+    case Type::kInf:
+      return power < 0 ? MakeZero(kSign) : MakeInf(kSign);
+    case Type::kDefault:
+      return MakeNan();
+  }
+}
+
+bool
+IsInteger(const BigFloat& number) noexcept {
+  return !IsSpecial(number) && IsEqual(TruncateFraction(number, 0), number);
+}
+
+// Whether `exponent` is an integer that fits in int64.
+bool
+IsSmallInteger(const BigFloat& exponent) noexcept {
+  return IsInteger(exponent) && GetLeadingBit(exponent) <= kMaxIntegerBit;
+}
+
+// Parity of an integer of any size: the lowest bit of its units limb.
+bool
+IsOdd(const BigFloat& integer) noexcept {
+  const Exponent kExponent = GetExponent(integer);
+  const limbs::LimbSpan kLimbs = GetLimbs(integer);
+  if (kExponent > 0 || static_cast<uint64_t>(-kExponent) >= kLimbs.size()) {
+    return false;
+  }
+  return kLimbs[static_cast<size_t>(-kExponent)] % 2 != 0;
+}
+
+int64_t
+ToInteger(const BigFloat& integer) noexcept {
+  const Approximation kApproximation = Approximate(integer);
+  const auto kMagnitude = static_cast<int64_t>(
+      kApproximation.top >> -kApproximation.bit_exponent);
+  return IsNegative(integer) ? -kMagnitude : kMagnitude;
+}
+
+// IEEE 754 pow for special operands and for a negative base with a
+// non-integer exponent.
+BigFloat
+PowSpecial(const BigFloat& base, const BigFloat& exponent) noexcept {
+  if (IsNan(base) || IsNan(exponent)) {
+    return MakeNan();
+  }
+  if (IsInf(exponent)) {
+    const BigFloat kOne = MakeInteger(1);
+    if (IsEqual(Abs(base), kOne)) {
+      return kOne;
+    }
+    const bool kIsGrowing =
+        IsGreater(Abs(base), kOne) != IsNegative(exponent);
+    return kIsGrowing ? MakeInf() : MakeZero();
+  }
+  if (IsZero(base)) {
+    return IsNegative(exponent) ? MakeInf() : MakeZero();
+  }
+  if (IsInf(base)) {
+    return IsNegative(exponent) ? MakeZero() : MakeInf();
+  }
+  return MakeNan();
+}
+
+}  // namespace
+
+BigFloat
+PowInt(const BigFloat& base, int64_t power, Precision precision) noexcept {
+  if (power == 0) {
+    return MakeInteger(1);
+  }
+  if (IsSpecial(base)) {
+    return PowIntSpecial(base, power);
+  }
+
+  const uint64_t kMagnitude = GetMagnitude(power);
+  const Precision kWorking = precision + kGuardBits +
+                             static_cast<Precision>(std::bit_width(kMagnitude));
+  const BigFloat kPower = PowMagnitude(base, kMagnitude, kWorking);
+  if (power > 0) {
+    return Truncate(kPower, precision);
+  }
+  return Div(MakeInteger(1), kPower, precision);
+}
+
+BigFloat
+Pow(const BigFloat& base, const BigFloat& exponent,
+    Precision precision) noexcept {
+  if (IsZero(exponent) || IsEqual(base, MakeInteger(1))) {
+    return MakeInteger(1);
+  }
+  if (IsSmallInteger(exponent)) {
+    return PowInt(base, ToInteger(exponent), precision);
+  }
+  if (IsNegative(base) && IsInteger(exponent)) {
+    const BigFloat kMagnitude = Pow(Abs(base), exponent, precision);
+    return IsOdd(exponent) ? Neg(kMagnitude) : kMagnitude;
+  }
+  if (IsSpecial(base) || IsSpecial(exponent) || IsNegative(base)) {
+    return PowSpecial(base, exponent);
+  }
+
+  // The absolute error of y log x becomes the relative error of the
+  // result, so log x needs as many extra bits as y log x has integer bits.
+  const Precision kWorking = precision + kGuardBits;
+  BigFloat product = Mul(exponent, Log(base, kWorking));
+  const int64_t kExtra = GetLeadingBit(product);
+  if (kExtra > 0) {
+    const auto kExtraBits = static_cast<Precision>(kExtra);
+    product = Mul(exponent, Log(base, kWorking + kExtraBits));
+  }
+  return Exp(product, precision);
+}
+
+}  // namespace big_float
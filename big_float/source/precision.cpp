@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+constexpr Precision kLimbBits = 64;
+
+template <typename Number>
+BigFloat
+TruncateNumber(const Number& number, Precision precision) noexcept {
+  const limbs::LimbSpan kLimbs = limbs::Trim(GetLimbs(number));
+  const Precision kWidth =
+      kLimbs.empty()
+          ? 0
+          : (kLimbs.size() - 1) * kLimbBits + std::bit_width(kLimbs.back());
+  if (IsSpecial(number) || kWidth <= precision) {
+    return ToBigFloat(number);
+  }
+
+  const Precision kDropped = kWidth - std::max<Precision>(precision, 1);
+  const auto kDroppedLimbs = static_cast<size_t>(kDropped / kLimbBits);
+  const auto kDroppedBits = static_cast<int>(kDropped % kLimbBits);
+  const limbs::LimbSpan kKept = kLimbs.subspan(kDroppedLimbs);
+
+  BigUInt mantissa;
+  mantissa.limbs.assign(kKept.begin(), kKept.end());
+  mantissa.limbs.front() &= ~limbs::Limb{0} << kDroppedBits;
+  const Exponent kExponent =
+      GetExponent(number) + static_cast<Exponent>(kDroppedLimbs);
+  return MakeBigFloat(std::move(mantissa), kExponent, GetSign(number),
+                      GetType(number), GetError(number));
+}
+
+}  // namespace
+
+BigFloat
+Truncate(const BigFloat& number, Precision precision) noexcept {
+  return TruncateNumber(number, precision);
+}
+
+BigFloat
+Truncate(const BigFloatView& view, Precision precision) noexcept {
+  return TruncateNumber(view, precision);
+}
+
+}  // namespace big_float
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "elementary.hpp"
+#include "getters.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr Precision kSeedPrecision = 48;
+
+int64_t
+FloorDivide(int64_t value, int64_t divisor) noexcept {
+  const int64_t kQuotient = value / divisor;
+  return value % divisor < 0 ? kQuotient - 1 : kQuotient;
+}
+
+// 2^(-log2(x) / n) from the leading bits of x in [1, 2^n).
+BigFloat
+GetSeed(const BigFloat& radicand, uint64_t degree) noexcept {
+  const Approximation kApproximation = Approximate(radicand);
+  const double kLog2 = static_cast<double>(kApproximation.bit_exponent) +
+                       std::log2(static_cast<double>(kApproximation.top));
+  return MakeFromDouble(std::exp2(-kLog2 / static_cast<double>(degree)));
+}
+
+// Newton iteration y' = y + y(1 - xy^n) / n for x^(-1/n); x^(1/n) =
+// x y^(n - 1) needs no division. The error squares at every step but is
+// scaled by about n / 2, so each step gains 2w - log2(n) bits.
+BigFloat
+RootMantissa(const BigFloat& radicand, uint64_t degree,
+             Precision precision) noexcept {
+  const BigFloat kOne = MakeInteger(1);
+  const BigFloat kDegree = MakeInteger(degree);
+  const auto kPower = static_cast<int64_t>(degree);
+  const Precision kStepLoss = std::bit_width(degree);
+  BigFloat reciprocal = GetSeed(radicand, degree);
+  Precision working = kSeedPrecision;
+  while (working < precision) {
+    working = std::min(std::max(2 * working, working + kStepLoss + 1) -
+                           kStepLoss,
+                       precision);
+    const Precision kWorking = working + kGuardBits;
+    const BigFloat kProduct = Truncate(
+        Mul(radicand, PowInt(reciprocal, kPower, kWorking)), kWorking);
+    const BigFloat kCorrection =
+        Div(Mul(reciprocal, Sub(kOne, kProduct)), kDegree, kWorking);
+    reciprocal = Truncate(Add(reciprocal, kCorrection), kWorking);
+  }
+  return Mul(radicand, PowInt(reciprocal, kPower - 1, precision + kGuardBits));
+}
+
+BigFloat
+NthRootNonSpecial(const BigFloat& operand, uint64_t degree,
+                  Precision precision) noexcept {
+  if (IsNegative(operand) && degree % 2 == 0) {
+    return MakeNan();
+  }
+
+  const auto kDegree = static_cast<int64_t>(degree);
+  const int64_t kShift = FloorDivide(GetLeadingBit(operand), kDegree);
+  const BigFloat kRadicand = Scale(Abs(operand), -kShift * kDegree);
+  const BigFloat kRoot =
+      Scale(RootMantissa(kRadicand, degree, precision + kGuardBits), kShift);
+  const BigFloat kResult = Truncate(kRoot, precision);
+  return IsNegative(operand) ? Neg(kResult) : kResult;
+}
+
+// Above the precision the root is within a few ulps of 1, and a degree past
+// INT64_MAX would not fit the exponent of PowInt, so exp(log|x| / n) is
+// used instead of Newton's iteration.
+BigFloat
+NthRootByLog(const BigFloat& operand, uint64_t degree,
+             Precision precision) noexcept {
+  if (IsNegative(operand) && degree % 2 == 0) {
+    return MakeNan();
+  }
+  const Precision kWorking = precision + kGuardBits;
+  const BigFloat kExponent =
+      Div(Log(Abs(operand), kWorking), MakeInteger(degree), kWorking);
+  const BigFloat kResult = Exp(kExponent, precision);
+  return IsNegative(operand) ? Neg(kResult) : kResult;
+}
+
+BigFloat
+NthRootSpecial(const BigFloat& operand, uint64_t degree) noexcept {
+  switch (GetType(operand)) {
+    case Type::kNan:
+    case Type::kZero:
+      return operand;
+    case Type::kInf:
+      return IsNegative(operand) && degree % 2 == 0 ? MakeNan() : operand;
+    case Type::kDefault:
+      return MakeNan();
+  }
+}
+
+}  // namespace
+
+BigFloat
+NthRoot(const BigFloat& operand, uint64_t degree,
+        Precision precision) noexcept {
+  if (degree == 0) {
+    return MakeNan();
+  }
+  if (IsSpecial(operand)) {
+    return NthRootSpecial(operand, degree);
+  }
+  if (degree == 1) {
+    return Truncate(operand, precision);
+  }
+  if (degree == 2) {
+    return Sqrt(operand, precision);
+  }
+  if (degree > precision) {
+    return NthRootByLog(operand, degree, precision);
+  }
+  return NthRootNonSpecial(operand, degree, precision);
+}
+
+}  // namespace big_float
@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <utility>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "precision.hpp"
+#include "rounding.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr int64_t kErrorUlpBits = 2;
+
+}  // namespace
+
+bool
+IsRoundable(const BigFloat& approximation, Precision working,
+            Precision precision) noexcept {
+  if (IsSpecial(approximation)) {
+    return true;
+  }
+  const int64_t kErrorBit = GetLeadingBit(approximation) + 1 -
+                            static_cast<int64_t>(working) + kErrorUlpBits;
+  const BigFloat kError = MakeScaled(1, kErrorBit);
+  const BigFloat kLower = Sub(approximation, kError);
+  const BigFloat kUpper = Add(approximation, kError);
+  if (IsNegative(kLower) != IsNegative(kUpper)) {
+    return false;
+  }
+  return IsEqual(Truncate(kLower, precision), Truncate(kUpper, precision));
+}
+
+BigFloat
+FinishRounded(BigFloat approximation, Precision precision,
+              bool is_proven) noexcept {
+  BigFloat result = Truncate(approximation, precision);
+  if (is_proven || IsSpecial(result)) {
+    return result;
+  }
+  const Exponent kExponent = GetExponent(result);
+  const Sign kSign = GetSign(result);
+  return MakeBigFloat(std::move(result.number), kExponent, kSign,
+                      Type::kDefault, MakeError(ErrorCode::kRoundingUnproven));
+}
+
+}  // namespace big_float
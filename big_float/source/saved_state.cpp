@@ -0,0 +1,178 @@
+#include "saved_state.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <span>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "error.hpp"
+#include "getters.hpp"
+#include "io.hpp"
+#include "precision.hpp"
+#include "stream.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr uint64_t kStateMagic = 0x3154534654464742;  // "BGFTFST1"
+constexpr uint32_t kStateVersion = 1;
+constexpr uint64_t kMaxWords = uint64_t{1} << 20;
+constexpr uint64_t kMaxNumbers = uint64_t{1} << 20;
+
+// Followed by `word_count` words and `number_count` streams. The checksum
+// covers the header and the words.
+struct StateHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t kind;
+  uint64_t precision;
+  uint64_t position;
+  uint64_t operand;
+  uint64_t word_count;
+  uint64_t number_count;
+  uint64_t checksum;
+};
+
+constexpr size_t kHeaderWords = 7;
+
+static_assert(sizeof(StateHeader) == (kHeaderWords + 1) * sizeof(uint64_t));
+
+uint64_t
+GetChecksum(const StateHeader& header,
+            std::span<const uint64_t> words) noexcept {
+  std::vector<uint64_t> covered(kHeaderWords);
+  std::memcpy(covered.data(), &header, kHeaderWords * sizeof(uint64_t));
+  covered.insert(covered.end(), words.begin(), words.end());
+  return io::Checksum(covered);
+}
+
+bool
+WriteNumber(int descriptor, const BigFloatView& number) noexcept {
+  StreamWriter writer = MakeStreamWriter(descriptor);
+  if (!IsSpecial(number)) {
+    WriteLimbs(writer, number.limbs);
+  }
+  return IsOk(FinishStream(writer, number.exp, number.sign, number.type,
+                           number.error));
+}
+
+bool
+WriteState(int descriptor, const SavedState& state,
+           std::span<const BigFloatView> numbers) noexcept {
+  StateHeader header{.magic = kStateMagic,
+                     .version = kStateVersion,
+                     .kind = static_cast<uint32_t>(state.kind),
+                     .precision = state.precision,
+                     .position = state.position,
+                     .operand = state.operand,
+                     .word_count = state.words.size(),
+                     .number_count = numbers.size(),
+                     .checksum = 0};
+  header.checksum = GetChecksum(header, state.words);
+  if (!io::WriteAll(descriptor, std::as_bytes(std::span(&header, 1))) ||
+      !io::WriteAll(descriptor, std::as_bytes(std::span(state.words)))) {
+    return false;
+  }
+  for (const BigFloatView& number : numbers) {
+    if (!WriteNumber(descriptor, number)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+LoadedState
+MakeStateError(ErrorCode code) noexcept {
+  return {.state = {.kind = SavedKind::kPi,
+                    .precision = 0,
+                    .position = 0,
+                    .operand = 0,
+                    .words = {}},
+          .numbers = {},
+          .error = MakeError(code)};
+}
+
+LoadedState
+ReadState(int descriptor, SavedKind kind) noexcept {
+  StateHeader header{};
+  if (!io::ReadAll(descriptor,
+                   std::as_writable_bytes(std::span(&header, 1)))) {
+    return MakeStateError(ErrorCode::kIoError);
+  }
+  if (header.magic != kStateMagic || header.version != kStateVersion ||
+      header.kind != static_cast<uint32_t>(kind) ||
+      header.word_count > kMaxWords || header.number_count > kMaxNumbers) {
+    return MakeStateError(ErrorCode::kInvalidFormat);
+  }
+
+  LoadedState loaded{
+      .state = {.kind = kind,
+                .precision = header.precision,
+                .position = header.position,
+                .operand = header.operand,
+                .words = std::vector<uint64_t>(header.word_count)},
+      .numbers = {},
+      .error = GetDefaultError()};
+  std::vector<uint64_t>& words = loaded.state.words;
+  if (!io::ReadAll(descriptor, std::as_writable_bytes(std::span(words)))) {
+    return MakeStateError(ErrorCode::kIoError);
+  }
+  if (header.checksum != GetChecksum(header, words)) {
+    return MakeStateError(ErrorCode::kChecksumMismatch);
+  }
+  for (uint64_t index = 0; index < header.number_count; ++index) {
+    BigFloat number = ReadStream(descriptor);
+    if (IsNan(number) && !IsOk(GetError(number))) {
+      return MakeStateError(GetErrorCode(GetError(number)));
+    }
+    loaded.numbers.push_back(std::move(number));
+  }
+  return loaded;
+}
+
+}  // namespace
+
+Error
+SaveState(const std::string& path, const SavedState& state,
+          std::span<const BigFloatView> numbers) noexcept {
+  const std::string kTemporary = path + ".tmp";
+  const int kDescriptor = ::open(
+      kTemporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (kDescriptor < 0) {
+    return MakeError(ErrorCode::kIoError);
+  }
+  const bool kIsWritten =
+      WriteState(kDescriptor, state, numbers) && ::fsync(kDescriptor) == 0;
+  const bool kIsClosed = ::close(kDescriptor) == 0;
+  if (!kIsWritten || !kIsClosed ||
+      ::rename(kTemporary.c_str(), path.c_str()) != 0) {
+    ::unlink(kTemporary.c_str());
+    return MakeError(ErrorCode::kIoError);
+  }
+  return GetDefaultError();
+}
+
+LoadedState
+LoadState(const std::string& path, SavedKind kind) noexcept {
+  const int kDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (kDescriptor < 0) {
+    return MakeStateError(ErrorCode::kIoError);
+  }
+  LoadedState loaded = ReadState(kDescriptor, kind);
+  ::close(kDescriptor);
+  return loaded;
+}
+
+void
+RemoveState(const std::string& path) noexcept {
+  ::unlink(path.c_str());
+}
+
+}  // namespace big_float
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "error.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+enum class SavedKind : uint32_t { kPi = 1, kDiv = 2 };
+
+// State of a restartable computation: how far it got (`position`), a
+// fingerprint of its inputs (`operand`) and engine-defined `words`. The
+// intermediate numbers travel next to it.
+struct SavedState {  // NOLINT
+  SavedKind kind;
+  Precision precision;
+  uint64_t position;
+  uint64_t operand;
+  std::vector<uint64_t> words;
+};
+
+struct LoadedState {  // NOLINT
+  SavedState state;
+  std::vector<BigFloat> numbers;
+  Error error;
+};
+
+// Writes path + ".tmp", syncs it and renames it over `path`. The numbers are
+// borrowed, so saving costs no copy of the working set.
+Error
+SaveState(const std::string& path, const SavedState& state,
+          std::span<const BigFloatView> numbers) noexcept;
+
+// Fails with kInvalidFormat when the file holds another kind of state.
+LoadedState
+LoadState(const std::string& path, SavedKind kind) noexcept;
+
+void
+RemoveState(const std::string& path) noexcept;
+
+}  // namespace big_float
@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "budget.hpp"
+#include "builders.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+constexpr int64_t kBitsPerLimb = 64;
+constexpr int kDoubleDigits = 53;
+constexpr size_t kDivisionLimbs = 3;
+constexpr uint64_t kDoubleSignMask = uint64_t{1} << 63;
+constexpr uint64_t kDoubleExponentMask = uint64_t{0x7FF} << 52;
+constexpr uint64_t kDoubleFractionMask = (uint64_t{1} << 52) - 1;
+
+// A machine operand laid out as limbs on the stack: one for an integer, at
+// most two for a double once its exponent is aligned to a limb boundary.
+struct Scalar {  // NOLINT
+  std::array<uint64_t, 2> limbs;
+  size_t size;
+  Exponent exp;
+  Sign sign;
+  Type type;
+};
+
+// |value| = mantissa * 2^bit_exponent for a finite non-zero double.
+struct DoubleParts {  // NOLINT
+  uint64_t mantissa;
+  int64_t bit_exponent;
+  Sign sign;
+};
+
+Sign
+GetValueSign(bool is_negative) noexcept {
+  return is_negative ? GetNegative() : GetPositive();
+}
+
+uint64_t
+GetMagnitude(int64_t value) noexcept {
+  const auto kValue = static_cast<uint64_t>(value);
+  return value < 0 ? 0 - kValue : kValue;
+}
+
+Sign
+GetProductSign(Sign lhs, Sign rhs) noexcept {
+  return IsEqual(lhs, rhs) ? GetPositive() : GetNegative();
+}
+
+// Reads the IEEE 754 fields directly: the release build uses
+// -ffinite-math-only, under which std::isnan and std::isinf fold to false.
+Type
+ClassifyDouble(double value) noexcept {
+  const auto kBits = std::bit_cast<uint64_t>(value);
+  if ((kBits & kDoubleExponentMask) == kDoubleExponentMask) {
+    return (kBits & kDoubleFractionMask) != 0 ? Type::kNan : Type::kInf;
+  }
+  return (kBits & ~kDoubleSignMask) == 0 ? Type::kZero : Type::kDefault;
+}
+
+Sign
+GetDoubleSign(double value) noexcept {
+  return GetValueSign((std::bit_cast<uint64_t>(value) & kDoubleSignMask) != 0);
+}
+
+bool
+IsRegular(double value) noexcept {
+  return ClassifyDouble(value) == Type::kDefault;
+}
+
+DoubleParts
+SplitDouble(double value) noexcept {
+  int exponent = 0;
+  const double kFraction = std::frexp(std::fabs(value), &exponent);
+  return {.mantissa =
+              static_cast<uint64_t>(std::ldexp(kFraction, kDoubleDigits)),
+          .bit_exponent = exponent - kDoubleDigits,
+          .sign = GetDoubleSign(value)};
+}
+
+Scalar
+MakeScalar(uint64_t magnitude, Sign sign) noexcept {
+  return {.limbs = {magnitude, 0},
+          .size = 1,
+          .exp = 0,
+          .sign = sign,
+          .type = magnitude == 0 ? Type::kZero : Type::kDefault};
+}
+
+Scalar
+MakeSpecialScalar(Type type, Sign sign) noexcept {
+  return {.limbs = {}, .size = 0, .exp = 0, .sign = sign, .type = type};
+}
+
+Scalar
+MakeScalar(double value) noexcept {
+  const Sign kSign = GetDoubleSign(value);
+  const Type kType = ClassifyDouble(value);
+  if (kType == Type::kZero) {
+    return MakeScalar(uint64_t{0}, kSign);
+  }
+  if (kType != Type::kDefault) {
+    return MakeSpecialScalar(kType, kSign);
+  }
+  const DoubleParts kParts = SplitDouble(value);
+  const int64_t kBits =
+      ((kParts.bit_exponent % kBitsPerLimb) + kBitsPerLimb) % kBitsPerLimb;
+  const uint64_t kHigh =
+      kBits == 0 ? 0 : kParts.mantissa >> (kBitsPerLimb - kBits);
+  return {.limbs = {kParts.mantissa << kBits, kHigh},
+          .size = kHigh == 0 ? size_t{1} : size_t{2},
+          .exp = (kParts.bit_exponent - kBits) / kBitsPerLimb,
+          .sign = kSign,
+          .type = Type::kDefault};
+}
+
+// The view borrows `scalar`, which must outlive it.
+BigFloatView
+ViewScalar(const Scalar& scalar) noexcept {
+  return MakeView(std::span(scalar.limbs.data(), scalar.size), scalar.exp,
+                  scalar.sign, scalar.type, GetDefaultError());
+}
+
+BigFloat
+MulLimb(const BigFloat& number, uint64_t factor, Sign sign) noexcept {
+  if (IsSpecial(number) || factor == 0) {
+    const Scalar kScalar = MakeScalar(factor, sign);
+    return Mul(MakeView(number), ViewScalar(kScalar));
+  }
+  if (!FitsMemoryBudget(GetLimbs(number).size() + 1)) {
+    return MakeOverBudget();
+  }
+  BigUInt product;
+  product.limbs = limbs::MulLimb(GetLimbs(number), factor);
+  return MakeBigFloat(std::move(product), GetExponent(number),
+                      GetProductSign(GetSign(number), sign), Type::kDefault,
+                      GetDefaultError());
+}
+
+// The numerator is padded with zero limbs until the quotient carries the
+// requested precision, as in the schoolbook division of two BigFloats.
+BigFloat
+DivLimb(const BigFloat& number, uint64_t divisor, Sign sign,
+        Precision precision) noexcept {
+  if (IsSpecial(number) || divisor == 0) {
+    return Div(number, MakeInteger(divisor, sign), precision);
+  }
+  const limbs::LimbSpan kNumerator = limbs::Trim(GetLimbs(number));
+  const size_t kQuotientLimbs =
+      static_cast<size_t>(precision / kBitsPerLimb) + kDivisionLimbs;
+  if (!FitsMemoryBudget(std::max(kQuotientLimbs, kNumerator.size()))) {
+    return MakeOverBudget();
+  }
+  const size_t kExtra = kQuotientLimbs > kNumerator.size()
+                            ? kQuotientLimbs - kNumerator.size()
+                            : 0;
+  BigUInt quotient;
+  quotient.limbs = limbs::DivLimb(kNumerator, divisor, kExtra);
+  const Exponent kExponent =
+      GetExponent(number) - static_cast<Exponent>(kExtra);
+  return Truncate(MakeBigFloat(std::move(quotient), kExponent,
+                               GetProductSign(GetSign(number), sign),
+                               Type::kDefault, GetDefaultError()),
+                  precision);
+}
+
+Precision
+GetDefaultPrecision(const BigFloat& dividend) noexcept {
+  return std::max<Precision>(GetBitWidth(dividend), kBitsPerLimb);
+}
+
+}  // namespace
+
+BigFloat
+Add(const BigFloat& augend, int64_t addend) noexcept {
+  const Scalar kScalar =
+      MakeScalar(GetMagnitude(addend), GetValueSign(addend < 0));
+  return Add(MakeView(augend), ViewScalar(kScalar));
+}
+
+BigFloat
+Add(const BigFloat& augend, uint64_t addend) noexcept {
+  const Scalar kScalar = MakeScalar(addend, GetPositive());
+  return Add(MakeView(augend), ViewScalar(kScalar));
+}
+
+BigFloat
+Add(const BigFloat& augend, double addend) noexcept {
+  const Scalar kScalar = MakeScalar(addend);
+  return Add(MakeView(augend), ViewScalar(kScalar));
+}
+
+BigFloat
+Sub(const BigFloat& minuend, int64_t subtrahend) noexcept {
+  const Scalar kScalar =
+      MakeScalar(GetMagnitude(subtrahend), GetValueSign(subtrahend < 0));
+  return Sub(MakeView(minuend), ViewScalar(kScalar));
+}
+
+BigFloat
+Sub(const BigFloat& minuend, uint64_t subtrahend) noexcept {
+  const Scalar kScalar = MakeScalar(subtrahend, GetPositive());
+  return Sub(MakeView(minuend), ViewScalar(kScalar));
+}
+
+BigFloat
+Sub(const BigFloat& minuend, double subtrahend) noexcept {
+  const Scalar kScalar = MakeScalar(subtrahend);
+  return Sub(MakeView(minuend), ViewScalar(kScalar));
+}
+
+BigFloat
+Mul(const BigFloat& multiplicand, int64_t multiplier) noexcept {
+  return MulLimb(multiplicand, GetMagnitude(multiplier),
+                 GetValueSign(multiplier < 0));
+}
+
+BigFloat
+Mul(const BigFloat& multiplicand, uint64_t multiplier) noexcept {
+  return MulLimb(multiplicand, multiplier, GetPositive());
+}
+
+BigFloat
+Mul(const BigFloat& multiplicand, double multiplier) noexcept {
+  if (!IsRegular(multiplier)) {
+    const Scalar kScalar = MakeScalar(multiplier);
+    return Mul(MakeView(multiplicand), ViewScalar(kScalar));
+  }
+  const DoubleParts kParts = SplitDouble(multiplier);
+  return Ldexp(MulLimb(multiplicand, kParts.mantissa, kParts.sign),
+               kParts.bit_exponent);
+}
+
+BigFloat
+Div(const BigFloat& dividend, int64_t divisor) noexcept {
+  return Div(dividend, divisor, GetDefaultPrecision(dividend));
+}
+
+BigFloat
+Div(const BigFloat& dividend, uint64_t divisor) noexcept {
+  return Div(dividend, divisor, GetDefaultPrecision(dividend));
+}
+
+BigFloat
+Div(const BigFloat& dividend, double divisor) noexcept {
+  return Div(dividend, divisor, GetDefaultPrecision(dividend));
+}
+
+BigFloat
+Div(const BigFloat& dividend, int64_t divisor, Precision precision) noexcept {
+  return DivLimb(dividend, GetMagnitude(divisor), GetValueSign(divisor < 0),
+                 precision);
+}
+
+BigFloat
+Div(const BigFloat& dividend, uint64_t divisor, Precision precision) noexcept {
+  return DivLimb(dividend, divisor, GetPositive(), precision);
+}
+
+BigFloat
+Div(const BigFloat& dividend, double divisor, Precision precision) noexcept {
+  if (!IsRegular(divisor)) {
+    const Scalar kScalar = MakeScalar(divisor);
+    return Div(dividend, ToBigFloat(ViewScalar(kScalar)), precision);
+  }
+  const DoubleParts kParts = SplitDouble(divisor);
+  return Ldexp(DivLimb(dividend, kParts.mantissa, kParts.sign, precision),
+               -kParts.bit_exponent);
+}
+
+}  // namespace big_float
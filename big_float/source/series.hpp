@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+#include "big_float.hpp"
+#include "precision.hpp"
+
+namespace big_float {
+
+// Term k of sum_k a(k) / b(k) * prod_{j <= k} p(j) / q(j).
+struct SeriesTerm {  // NOLINT
+  BigFloat a;
+  BigFloat b;
+  BigFloat p;
+  BigFloat q;
+};
+
+struct SeriesSplit {  // NOLINT
+  BigFloat p;
+  BigFloat q;
+  BigFloat b;
+  BigFloat t;
+};
+
+// Binary splitting over [begin, end): all products are exact, so the only
+// rounding happens in the final division.
+template <typename Terms>
+SeriesSplit
+SplitSeries(const Terms& terms, uint64_t begin, uint64_t end) noexcept {
+  if (end - begin == 1) {
+    SeriesTerm term = terms(begin);
+    BigFloat t = Mul(term.a, term.p);
+    return {.p = term.p, .q = term.q, .b = term.b, .t = t};
+  }
+  const uint64_t kMiddle = begin + (end - begin) / 2;
+  const SeriesSplit kLeft = SplitSeries(terms, begin, kMiddle);
+  const SeriesSplit kRight = SplitSeries(terms, kMiddle, end);
+  return {.p = Mul(kLeft.p, kRight.p),
+          .q = Mul(kLeft.q, kRight.q),
+          .b = Mul(kLeft.b, kRight.b),
+          .t = Add(Mul(Mul(kRight.b, kRight.q), kLeft.t),
+                   Mul(Mul(kLeft.b, kLeft.p), kRight.t))};
+}
+
+template <typename Terms>
+BigFloat
+SumSeries(const Terms& terms, uint64_t count, Precision precision) noexcept {
+  const SeriesSplit kSplit = SplitSeries(terms, 0, count);
+  return Div(kSplit.t, Mul(kSplit.b, kSplit.q), precision);
+}
+
+}  // namespace big_float
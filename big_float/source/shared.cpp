@@ -0,0 +1,90 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "getters.hpp"
+#include "shared.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+// use_count() is a relaxed load; the fence orders it after the release
+// decrements of handles dropped by other threads, so their reads of the
+// limbs happen before we modify or move them.
+bool
+IsUnique(const SharedBigFloat& number) noexcept {
+  const bool kIsUnique = number.mantissa.use_count() == 1;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return kIsUnique;
+}
+
+// Every mantissa is allocated as a non-const BigUInt, so the sole owner may
+// cast the const away.
+BigUInt&
+GetOwnedMantissa(const SharedBigFloat& number) noexcept {
+  return const_cast<BigUInt&>(*number.mantissa);  // NOLINT
+}
+
+}  // namespace
+
+SharedBigFloat
+Share(BigFloat number) noexcept {
+  if (IsSpecial(number)) {
+    return {.mantissa = nullptr, .exp_and_header = number.exp_and_header};
+  }
+  return {.mantissa = std::make_shared<BigUInt>(std::move(number.number)),
+          .exp_and_header = number.exp_and_header};
+}
+
+BigFloat
+Unshare(SharedBigFloat number) noexcept {
+  if (!number.mantissa) {
+    return {.number = BigUInt{}, .exp_and_header = number.exp_and_header};
+  }
+  BigUInt mantissa =
+      IsUnique(number) ? std::move(GetOwnedMantissa(number)) : *number.mantissa;
+  return {.number = std::move(mantissa),
+          .exp_and_header = number.exp_and_header};
+}
+
+BigFloatView
+MakeView(const SharedBigFloat& number) noexcept {
+  const BigFloat kPacked{.number = BigUInt{},
+                         .exp_and_header = number.exp_and_header};
+  const std::span<const uint64_t> kLimbs =
+      number.mantissa ? std::span<const uint64_t>(number.mantissa->limbs)
+                      : std::span<const uint64_t>();
+  return MakeView(kLimbs, GetExponent(kPacked), GetSign(kPacked),
+                  GetType(kPacked), GetError(kPacked));
+}
+
+SharedBigFloat
+Neg(SharedBigFloat number) noexcept {
+  number.exp_and_header ^= kSignMask;
+  return number;
+}
+
+SharedBigFloat
+Abs(SharedBigFloat number) noexcept {
+  number.exp_and_header &= ~uint64_t{kSignMask};
+  return number;
+}
+
+BigUInt&
+GetMutableMantissa(SharedBigFloat& number) noexcept {
+  if (!number.mantissa) {
+    number.mantissa = std::make_shared<BigUInt>();
+  } else if (!IsUnique(number)) {
+    number.mantissa = std::make_shared<BigUInt>(*number.mantissa);
+  }
+  return GetOwnedMantissa(number);
+}
+
+}  // namespace big_float
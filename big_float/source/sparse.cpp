@@ -0,0 +1,402 @@
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "sign.hpp"
+#include "sparse.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+using Runs = std::vector<LimbRun>;
+
+constexpr Exponent kNoLimb = std::numeric_limits<Exponent>::min();
+constexpr uint64_t kAllOnes = std::numeric_limits<uint64_t>::max();
+
+Exponent
+GetEnd(const LimbRun& run) noexcept {
+  return run.exp + static_cast<Exponent>(run.limbs.size());
+}
+
+// Appends non-zero limbs starting at `exp`, which must lie at or above the
+// end of the last run. A gap shorter than kSparseGap is stored as zeros.
+void
+AppendRun(Runs& runs, Exponent exp, limbs::LimbSpan limbs) noexcept {
+  if (!runs.empty() && exp - GetEnd(runs.back()) < kSparseGap) {
+    std::vector<uint64_t>& last = runs.back().limbs;
+    last.resize(static_cast<size_t>(exp - runs.back().exp), 0);
+    last.insert(last.end(), limbs.begin(), limbs.end());
+    return;
+  }
+  runs.push_back({.exp = exp, .limbs = {limbs.begin(), limbs.end()}});
+}
+
+// Splits dense limbs at zero runs of at least kSparseGap limbs.
+void
+AppendDense(Runs& runs, Exponent exp, limbs::LimbSpan limbs) noexcept {
+  size_t index = 0;
+  while (index < limbs.size()) {
+    if (limbs[index] == 0) {
+      ++index;
+      continue;
+    }
+    const size_t kBegin = index;
+    size_t end = index + 1;
+    for (size_t zeros = 0; index < limbs.size() && zeros < kSparseGap;
+         ++index) {
+      zeros = limbs[index] == 0 ? zeros + 1 : 0;
+      if (zeros == 0) {
+        end = index + 1;
+      }
+    }
+    AppendRun(runs, exp + static_cast<Exponent>(kBegin),
+              limbs.subspan(kBegin, end - kBegin));
+    index = end;
+  }
+}
+
+void
+AppendFill(Runs& runs, Exponent begin, Exponent end, uint64_t limb) {
+  if (begin < end) {
+    const std::vector<uint64_t> kFill(static_cast<size_t>(end - begin), limb);
+    AppendRun(runs, begin, kFill);
+  }
+}
+
+// Next run in ascending order from either operand.
+struct RunCursor {  // NOLINT
+  const Runs& lhs;
+  const Runs& rhs;
+  size_t lhs_index;
+  size_t rhs_index;
+};
+
+bool
+HasNext(const RunCursor& cursor) noexcept {
+  return cursor.lhs_index < cursor.lhs.size() ||
+         cursor.rhs_index < cursor.rhs.size();
+}
+
+Exponent
+PeekExp(const RunCursor& cursor) noexcept {
+  const Exponent kLhs = cursor.lhs_index < cursor.lhs.size()
+                            ? cursor.lhs[cursor.lhs_index].exp
+                            : std::numeric_limits<Exponent>::max();
+  const Exponent kRhs = cursor.rhs_index < cursor.rhs.size()
+                            ? cursor.rhs[cursor.rhs_index].exp
+                            : std::numeric_limits<Exponent>::max();
+  return std::min(kLhs, kRhs);
+}
+
+// Runs of both operands that overlap or touch form one cluster, summed
+// densely with one spare limb at the top so that its carry stays inside.
+// The clusters are the only limbs ever written.
+struct Cluster {  // NOLINT
+  Exponent exp;
+  std::vector<const LimbRun*> lhs;
+  std::vector<const LimbRun*> rhs;
+  Exponent end;
+};
+
+Cluster
+NextCluster(RunCursor& cursor, Exponent slack) noexcept {
+  Cluster cluster = {.exp = PeekExp(cursor), .lhs = {}, .rhs = {}, .end = 0};
+  cluster.end = cluster.exp;
+  while (HasNext(cursor) && PeekExp(cursor) <= cluster.end + slack) {
+    const bool kFromLhs = cursor.lhs_index < cursor.lhs.size() &&
+                          cursor.lhs[cursor.lhs_index].exp == PeekExp(cursor);
+    const LimbRun& run = kFromLhs ? cursor.lhs[cursor.lhs_index++]
+                                  : cursor.rhs[cursor.rhs_index++];
+    (kFromLhs ? cluster.lhs : cluster.rhs).push_back(&run);
+    cluster.end = std::max(cluster.end, GetEnd(run));
+  }
+  return cluster;
+}
+
+void
+Place(std::vector<uint64_t>& dense, Exponent exp,
+      const std::vector<const LimbRun*>& runs) noexcept {
+  for (const LimbRun* run : runs) {
+    std::copy(run->limbs.begin(), run->limbs.end(),
+              dense.begin() + static_cast<std::ptrdiff_t>(run->exp - exp));
+  }
+}
+
+// dense += runs; the top limb of `dense` must be free to take the carry.
+void
+AddRuns(std::vector<uint64_t>& dense, Exponent exp,
+        const std::vector<const LimbRun*>& runs) noexcept {
+  for (const LimbRun* run : runs) {
+    uint64_t carry = 0;
+    auto index = static_cast<size_t>(run->exp - exp);
+    for (const uint64_t kLimb : run->limbs) {
+      const uint64_t kPartial = dense[index] + kLimb;
+      const uint64_t kSum = kPartial + carry;
+      carry = static_cast<uint64_t>(kPartial < kLimb) |
+              static_cast<uint64_t>(kSum < kPartial);
+      dense[index++] = kSum;
+    }
+    for (; carry != 0; ++index) {
+      dense[index] += 1;
+      carry = static_cast<uint64_t>(dense[index] == 0);
+    }
+  }
+}
+
+// dense -= subtrahend + borrow over equal lengths; returns the borrow out.
+uint64_t
+SubDense(std::vector<uint64_t>& dense, const std::vector<uint64_t>& subtrahend,
+         uint64_t borrow) noexcept {
+  for (size_t index = 0; index < dense.size(); ++index) {
+    const uint64_t kMinuend = dense[index];
+    const uint64_t kPartial = kMinuend - subtrahend[index];
+    dense[index] = kPartial - borrow;
+    borrow = static_cast<uint64_t>(kMinuend < subtrahend[index]) |
+             static_cast<uint64_t>(kPartial < borrow);
+  }
+  return borrow;
+}
+
+Runs
+AddMagnitudes(const Runs& lhs, const Runs& rhs) noexcept {
+  Runs result;
+  RunCursor cursor = {.lhs = lhs, .rhs = rhs, .lhs_index = 0, .rhs_index = 0};
+  while (HasNext(cursor)) {
+    const Cluster kCluster = NextCluster(cursor, 1);
+    std::vector<uint64_t> sum(
+        static_cast<size_t>(kCluster.end - kCluster.exp) + 1, 0);
+    Place(sum, kCluster.exp, kCluster.lhs);
+    AddRuns(sum, kCluster.exp, kCluster.rhs);
+    AppendDense(result, kCluster.exp, sum);
+  }
+  return result;
+}
+
+// larger - smaller for larger > smaller. A borrow out of a cluster turns
+// the gap above it into all-ones limbs, the only case where a gap is
+// written.
+Runs
+SubMagnitudes(const Runs& larger, const Runs& smaller) noexcept {
+  Runs result;
+  RunCursor cursor = {
+      .lhs = larger, .rhs = smaller, .lhs_index = 0, .rhs_index = 0};
+  uint64_t borrow = 0;
+  Exponent previous_end = 0;
+  while (HasNext(cursor)) {
+    const Cluster kCluster = NextCluster(cursor, 0);
+    const auto kSize = static_cast<size_t>(kCluster.end - kCluster.exp);
+    std::vector<uint64_t> difference(kSize, 0);
+    std::vector<uint64_t> subtrahend(kSize, 0);
+    Place(difference, kCluster.exp, kCluster.lhs);
+    Place(subtrahend, kCluster.exp, kCluster.rhs);
+    if (borrow != 0) {
+      AppendFill(result, previous_end, kCluster.exp, kAllOnes);
+    }
+    borrow = SubDense(difference, subtrahend, borrow);
+    AppendDense(result, kCluster.exp, difference);
+    previous_end = kCluster.end;
+  }
+  return result;
+}
+
+std::strong_ordering
+CompareMagnitudes(const Runs& lhs, const Runs& rhs) noexcept {
+  size_t lhs_count = lhs.size();
+  size_t rhs_count = rhs.size();
+  Exponent position = std::numeric_limits<Exponent>::max();
+  while (true) {
+    while (lhs_count > 0 && lhs[lhs_count - 1].exp >= position) {
+      --lhs_count;
+    }
+    while (rhs_count > 0 && rhs[rhs_count - 1].exp >= position) {
+      --rhs_count;
+    }
+    const Exponent kLhsEnd =
+        lhs_count > 0 ? std::min(position, GetEnd(lhs[lhs_count - 1]))
+                      : kNoLimb;
+    const Exponent kRhsEnd =
+        rhs_count > 0 ? std::min(position, GetEnd(rhs[rhs_count - 1]))
+                      : kNoLimb;
+    if (kLhsEnd == kNoLimb && kRhsEnd == kNoLimb) {
+      return std::strong_ordering::equal;
+    }
+    // Skip limbs that are zero in both operands.
+    position = std::max(kLhsEnd, kRhsEnd);
+    const Exponent kLimb = position - 1;
+    const uint64_t kLhsLimb =
+        kLhsEnd == position
+            ? lhs[lhs_count - 1].limbs[static_cast<size_t>(
+                  kLimb - lhs[lhs_count - 1].exp)]
+            : 0;
+    const uint64_t kRhsLimb =
+        kRhsEnd == position
+            ? rhs[rhs_count - 1].limbs[static_cast<size_t>(
+                  kLimb - rhs[rhs_count - 1].exp)]
+            : 0;
+    if (kLhsLimb != kRhsLimb) {
+      return kLhsLimb <=> kRhsLimb;
+    }
+    position = kLimb;
+  }
+}
+
+SparseBigFloat
+MakeSparse(Runs runs, Sign sign) noexcept {
+  if (runs.empty()) {
+    return {.runs = {},
+            .type = Type::kZero,
+            .sign = GetPositive(),
+            .error = GetDefaultError()};
+  }
+  return {.runs = std::move(runs),
+          .type = Type::kDefault,
+          .sign = sign,
+          .error = GetDefaultError()};
+}
+
+// Stand-in for `number` in the special-value rules of the dense kernels,
+// which never look at the limbs of a finite operand's magnitude beyond its
+// being non-zero.
+BigFloatView
+MakeSpecialView(const SparseBigFloat& number) noexcept {
+  const limbs::LimbSpan kLimbs =
+      number.runs.empty() ? limbs::LimbSpan{} : number.runs.back().limbs;
+  const Exponent kExp = number.runs.empty() ? 0 : number.runs.back().exp;
+  return MakeView(kLimbs, kExp, number.sign, number.type, number.error);
+}
+
+bool
+IsSpecial(const SparseBigFloat& number) noexcept {
+  return number.type != Type::kDefault;
+}
+
+// Order of two finite non-zero values.
+std::strong_ordering
+CompareNonSpecial(const SparseBigFloat& lhs,
+                  const SparseBigFloat& rhs) noexcept {
+  if (!IsEqual(lhs.sign, rhs.sign)) {
+    return IsNegative(lhs.sign) ? std::strong_ordering::less
+                                : std::strong_ordering::greater;
+  }
+  const std::strong_ordering kOrder = CompareMagnitudes(lhs.runs, rhs.runs);
+  return IsNegative(lhs.sign) ? 0 <=> kOrder : kOrder;
+}
+
+}  // namespace
+
+SparseBigFloat
+MakeSparse(const BigFloatView& number) noexcept {
+  if (IsSpecial(number)) {
+    return {.runs = {},
+            .type = GetType(number),
+            .sign = GetSign(number),
+            .error = GetError(number)};
+  }
+  Runs runs;
+  AppendDense(runs, GetExponent(number), GetLimbs(number));
+  SparseBigFloat result = MakeSparse(std::move(runs), GetSign(number));
+  result.error = GetError(number);
+  return result;
+}
+
+SparseBigFloat
+MakeSparse(const BigFloat& number) noexcept {
+  return MakeSparse(MakeView(number));
+}
+
+BigFloat
+ToBigFloat(const SparseBigFloat& number) noexcept {
+  if (IsSpecial(number)) {
+    return MakeBigFloat(BigUInt{}, 0, number.sign, number.type, number.error);
+  }
+  const Exponent kExp = number.runs.front().exp;
+  BigUInt mantissa;
+  mantissa.limbs.resize(static_cast<size_t>(GetEnd(number.runs.back()) - kExp));
+  for (const LimbRun& run : number.runs) {
+    std::copy(run.limbs.begin(), run.limbs.end(),
+              mantissa.limbs.begin() +
+                  static_cast<std::ptrdiff_t>(run.exp - kExp));
+  }
+  return MakeBigFloat(std::move(mantissa), kExp, number.sign, Type::kDefault,
+                      number.error);
+}
+
+SparseBigFloat
+Neg(SparseBigFloat number) noexcept {
+  number.sign = Invert(number.sign);
+  return number;
+}
+
+SparseBigFloat
+Add(const SparseBigFloat& augend, const SparseBigFloat& addend) noexcept {
+  if (IsSpecial(augend) || IsSpecial(addend)) {
+    if (augend.type == Type::kZero) {
+      return addend;
+    }
+    if (addend.type == Type::kZero) {
+      return augend;
+    }
+    return MakeSparse(Add(MakeSpecialView(augend), MakeSpecialView(addend)));
+  }
+  if (IsEqual(augend.sign, addend.sign)) {
+    return MakeSparse(AddMagnitudes(augend.runs, addend.runs), augend.sign);
+  }
+  const std::strong_ordering kOrder =
+      CompareMagnitudes(augend.runs, addend.runs);
+  if (kOrder == std::strong_ordering::greater) {
+    return MakeSparse(SubMagnitudes(augend.runs, addend.runs), augend.sign);
+  }
+  return MakeSparse(SubMagnitudes(addend.runs, augend.runs), addend.sign);
+}
+
+SparseBigFloat
+Sub(const SparseBigFloat& minuend, const SparseBigFloat& subtrahend) noexcept {
+  return Add(minuend, Neg(subtrahend));
+}
+
+SparseBigFloat
+Mul(const SparseBigFloat& multiplicand,
+    const SparseBigFloat& multiplier) noexcept {
+  return MakeSparse(Mul(ToBigFloat(multiplicand), ToBigFloat(multiplier)));
+}
+
+bool
+IsEqual(const SparseBigFloat& left, const SparseBigFloat& right) noexcept {
+  if (IsSpecial(left) || IsSpecial(right)) {
+    return IsEqual(MakeSpecialView(left), MakeSpecialView(right));
+  }
+  return CompareNonSpecial(left, right) == std::strong_ordering::equal;
+}
+
+bool
+IsGreater(const SparseBigFloat& left, const SparseBigFloat& right) noexcept {
+  if (IsSpecial(left) || IsSpecial(right)) {
+    return IsGreater(MakeSpecialView(left), MakeSpecialView(right));
+  }
+  return CompareNonSpecial(left, right) == std::strong_ordering::greater;
+}
+
+bool
+IsLower(const SparseBigFloat& left, const SparseBigFloat& right) noexcept {
+  if (IsSpecial(left) || IsSpecial(right)) {
+    return IsLower(MakeSpecialView(left), MakeSpecialView(right));
+  }
+  return CompareNonSpecial(left, right) == std::strong_ordering::less;
+}
+
+}  // namespace big_float
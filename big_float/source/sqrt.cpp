@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "builders.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+constexpr Precision kLimbBits = 64;
+constexpr Precision kGuardBits = 64;
+constexpr Precision kSeedPrecision = 48;
+constexpr int kSeedScale = 85;
+
+// 1 / sqrt(radicand) from the leading 64 bits, good to ~50 bits.
+BigFloat
+GetSeed(const BigFloat& radicand) noexcept {
+  const Approximation kApproximation = Approximate(radicand);
+  double top = static_cast<double>(kApproximation.top);
+  int64_t bit_exponent = kApproximation.bit_exponent;
+  if (bit_exponent % 2 != 0) {
+    top *= 2;
+    bit_exponent -= 1;
+  }
+  const auto kSeed =
+      static_cast<uint64_t>(std::ldexp(1.0 / std::sqrt(top), kSeedScale));
+  return MakeScaled(kSeed, -kSeedScale - bit_exponent / 2);
+}
+
+// Newton iteration y' = y + y(1 - xy^2) / 2 for 1 / sqrt(x), doubling the
+// working precision at every step; sqrt(x) = xy needs no division.
+BigFloat
+SqrtMantissa(const BigFloat& radicand, Precision precision) noexcept {
+  const BigFloat kOne = MakeInteger(1);
+  const BigFloat kHalf = MakeScaled(1, -1);
+  BigFloat reciprocal = GetSeed(radicand);
+  Precision working = kSeedPrecision;
+  while (working < precision) {
+    working = std::min(2 * working, precision);
+    const Precision kWorking = working + kGuardBits;
+    const BigFloat kSquare = Truncate(Sqr(reciprocal), kWorking);
+    const BigFloat kProduct =
+        Truncate(Mul(Truncate(radicand, kWorking), kSquare), kWorking);
+    const BigFloat kResidual = Sub(kOne, kProduct);
+    const BigFloat kCorrection =
+        Truncate(Mul(Mul(reciprocal, kResidual), kHalf), kWorking);
+    reciprocal = Truncate(Add(reciprocal, kCorrection), kWorking);
+  }
+  return Mul(Truncate(radicand, precision + kGuardBits), reciprocal);
+}
+
+BigFloat
+SqrtNonSpecial(const BigFloat& operand, Precision precision) noexcept {
+  const limbs::LimbSpan kMantissa = limbs::Trim(GetLimbs(operand));
+  Exponent exponent = GetExponent(operand);
+  BigUInt radicand;
+  if (exponent % 2 != 0) {
+    radicand.limbs.push_back(0);
+    exponent -= 1;
+  }
+  radicand.limbs.insert(radicand.limbs.end(), kMantissa.begin(),
+                        kMantissa.end());
+
+  const BigFloat kRoot = SqrtMantissa(
+      MakeBigFloat(std::move(radicand), 0, GetPositive(), Type::kDefault,
+                   GetDefaultError()),
+      precision + kGuardBits);
+  return Truncate(MakeBigFloat(GetMantissa(kRoot),
+                               GetExponent(kRoot) + exponent / 2,
+                               GetPositive(), Type::kDefault,
+                               GetDefaultError()),
+                  precision);
+}
+
+BigFloat
+SqrtSpecial(const BigFloat& operand) noexcept {
+  switch (GetType(operand)) {
+    case Type::kNan:
+    case Type::kZero:
+      return operand;
+    case Type::kInf:
+      return IsNegative(operand) ? MakeNan() : operand;
+    case Type::kDefault:
+      return MakeNan();
+  }
+}
+
+}  // namespace
+
+BigFloat
+Sqrt(const BigFloat& operand) noexcept {
+  return Sqrt(operand, std::max(GetBitWidth(operand), kLimbBits));
+}
+
+BigFloat
+Sqrt(const BigFloat& operand, Precision precision) noexcept {
+  if (IsDefaultPositive(operand)) {
+    return SqrtNonSpecial(operand, precision);
+  }
+  return SqrtSpecial(operand);
+}
+
+}  // namespace big_float
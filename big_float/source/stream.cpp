@@ -0,0 +1,304 @@
+#include "stream.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <unistd.h>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "io.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+namespace {
+
+constexpr uint64_t kStreamMagic = 0x3152545354464742;  // "BGFTSTR1"
+constexpr uint32_t kStreamVersion = 1;
+constexpr uint64_t kMaxChunkLimbs = uint64_t{1} << 24;
+
+struct StreamHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t chunk_limbs;
+};
+
+struct ChunkHeader {
+  uint64_t count;
+  uint64_t checksum;
+};
+
+struct StreamTrailer {
+  int64_t exp;
+  uint8_t type;
+  uint8_t sign;
+  uint8_t error;
+  std::array<uint8_t, 5> reserved;
+  uint64_t total_limbs;
+  uint64_t checksum;
+};
+
+static_assert(sizeof(StreamTrailer) == 32);
+
+template <typename Value>
+bool
+WriteValue(int descriptor, const Value& value) noexcept {
+  return io::WriteAll(descriptor, std::as_bytes(std::span(&value, 1)));
+}
+
+template <typename Value>
+bool
+ReadValue(int descriptor, Value& value) noexcept {
+  return io::ReadAll(descriptor, std::as_writable_bytes(std::span(&value, 1)));
+}
+
+uint64_t
+GetTrailerChecksum(const StreamTrailer& trailer) noexcept {
+  std::array<uint64_t, 3> words{};
+  std::memcpy(words.data(), &trailer, sizeof(words));
+  return io::Checksum(words);
+}
+
+const Error&
+Fail(StreamWriter& writer, ErrorCode code) noexcept {
+  writer.error = MakeError(code);
+  return writer.error;
+}
+
+std::span<const uint64_t>
+Fail(StreamReader& reader, ErrorCode code) noexcept {
+  reader.error = MakeError(code);
+  return {};
+}
+
+bool
+EmitChunk(const StreamWriter& writer,
+          std::span<const uint64_t> limbs) noexcept {
+  const ChunkHeader kHeader{.count = limbs.size(),
+                            .checksum = io::Checksum(limbs)};
+  return WriteValue(writer.descriptor, kHeader) &&
+         io::WriteAll(writer.descriptor, std::as_bytes(limbs));
+}
+
+bool
+EmitPending(StreamWriter& writer) noexcept {
+  if (writer.pending.empty()) {
+    return true;
+  }
+  const bool kIsWritten = EmitChunk(writer, writer.pending);
+  writer.pending.clear();
+  return kIsWritten;
+}
+
+void
+ReadTrailer(StreamReader& reader) noexcept {
+  StreamTrailer trailer{};
+  if (!ReadValue(reader.descriptor, trailer)) {
+    Fail(reader, ErrorCode::kIoError);
+    return;
+  }
+  if (trailer.checksum != GetTrailerChecksum(trailer)) {
+    Fail(reader, ErrorCode::kChecksumMismatch);
+    return;
+  }
+  if (trailer.total_limbs != reader.total_limbs ||
+      trailer.type > static_cast<uint8_t>(Type::kNan) ||
+      !IsErrorCode(trailer.error)) {
+    Fail(reader, ErrorCode::kInvalidFormat);
+    return;
+  }
+  reader.exp = trailer.exp;
+  reader.type = static_cast<Type>(trailer.type);
+  reader.sign = trailer.sign != 0;
+  reader.value_error = MakeError(static_cast<ErrorCode>(trailer.error));
+  reader.is_finished = true;
+}
+
+}  // namespace
+
+StreamWriter
+MakeStreamWriter(int descriptor, size_t chunk_limbs) noexcept {
+  StreamWriter writer{
+      .descriptor = descriptor,
+      .chunk_limbs = std::clamp<size_t>(chunk_limbs, 1, kMaxChunkLimbs),
+      .pending = {},
+      .total_limbs = 0,
+      .error = GetDefaultError()};
+  const StreamHeader kHeader{.magic = kStreamMagic,
+                             .version = kStreamVersion,
+                             .reserved = 0,
+                             .chunk_limbs = writer.chunk_limbs};
+  if (!WriteValue(descriptor, kHeader)) {
+    Fail(writer, ErrorCode::kIoError);
+  }
+  return writer;
+}
+
+const Error&
+WriteLimbs(StreamWriter& writer, std::span<const uint64_t> limbs) noexcept {
+  if (!IsOk(writer.error)) {
+    return writer.error;
+  }
+  writer.total_limbs += limbs.size();
+
+  if (!writer.pending.empty()) {
+    const size_t kFree = writer.chunk_limbs - writer.pending.size();
+    const size_t kTaken = std::min(kFree, limbs.size());
+    writer.pending.insert(writer.pending.end(), limbs.begin(),
+                          limbs.begin() + static_cast<std::ptrdiff_t>(kTaken));
+    limbs = limbs.subspan(kTaken);
+    if (writer.pending.size() == writer.chunk_limbs && !EmitPending(writer)) {
+      return Fail(writer, ErrorCode::kIoError);
+    }
+  }
+
+  while (limbs.size() >= writer.chunk_limbs) {
+    if (!EmitChunk(writer, limbs.first(writer.chunk_limbs))) {
+      return Fail(writer, ErrorCode::kIoError);
+    }
+    limbs = limbs.subspan(writer.chunk_limbs);
+  }
+  writer.pending.insert(writer.pending.end(), limbs.begin(), limbs.end());
+  return writer.error;
+}
+
+const Error&
+FlushStream(StreamWriter& writer) noexcept {
+  if (!IsOk(writer.error)) {
+    return writer.error;
+  }
+  if (!EmitPending(writer)) {
+    return Fail(writer, ErrorCode::kIoError);
+  }
+  if (::fdatasync(writer.descriptor) != 0 && errno != EINVAL) {
+    return Fail(writer, ErrorCode::kIoError);
+  }
+  return writer.error;
+}
+
+const Error&
+FinishStream(StreamWriter& writer, Exponent exp, Sign sign, Type type,
+             Error error) noexcept {
+  if (!IsOk(writer.error)) {
+    return writer.error;
+  }
+  const ChunkHeader kEnd{.count = 0, .checksum = 0};
+  StreamTrailer trailer{.exp = exp,
+                        .type = static_cast<uint8_t>(type),
+                        .sign = static_cast<uint8_t>(sign),
+                        .error = static_cast<uint8_t>(GetErrorCode(error)),
+                        .reserved = {},
+                        .total_limbs = writer.total_limbs,
+                        .checksum = 0};
+  trailer.checksum = GetTrailerChecksum(trailer);
+  if (!EmitPending(writer) || !WriteValue(writer.descriptor, kEnd) ||
+      !WriteValue(writer.descriptor, trailer)) {
+    return Fail(writer, ErrorCode::kIoError);
+  }
+  return writer.error;
+}
+
+Error
+WriteStream(int descriptor, const BigFloat& number,
+            size_t chunk_limbs) noexcept {
+  StreamWriter writer = MakeStreamWriter(descriptor, chunk_limbs);
+  if (!IsSpecial(number)) {
+    WriteLimbs(writer, GetLimbs(number));
+  }
+  return FinishStream(writer, GetExponent(number), GetSign(number),
+                      GetType(number), GetError(number));
+}
+
+StreamReader
+MakeStreamReader(int descriptor) noexcept {
+  StreamReader reader{.descriptor = descriptor,
+                      .chunk_limbs = 0,
+                      .chunk = {},
+                      .total_limbs = 0,
+                      .is_finished = false,
+                      .exp = 0,
+                      .type = Type::kNan,
+                      .sign = GetPositive(),
+                      .value_error = GetDefaultError(),
+                      .error = GetDefaultError()};
+  StreamHeader header{};
+  if (!ReadValue(descriptor, header)) {
+    Fail(reader, ErrorCode::kIoError);
+    return reader;
+  }
+  if (header.magic != kStreamMagic || header.version != kStreamVersion ||
+      header.chunk_limbs == 0 || header.chunk_limbs > kMaxChunkLimbs) {
+    Fail(reader, ErrorCode::kInvalidFormat);
+    return reader;
+  }
+  reader.chunk_limbs = header.chunk_limbs;
+  return reader;
+}
+
+std::span<const uint64_t>
+ReadChunk(StreamReader& reader) noexcept {
+  if (!IsOk(reader.error) || reader.is_finished) {
+    return {};
+  }
+  ChunkHeader header{};
+  if (!ReadValue(reader.descriptor, header)) {
+    return Fail(reader, ErrorCode::kIoError);
+  }
+  if (header.count == 0) {
+    ReadTrailer(reader);
+    return {};
+  }
+  if (header.count > reader.chunk_limbs) {
+    return Fail(reader, ErrorCode::kInvalidFormat);
+  }
+
+  reader.chunk.resize(header.count);
+  if (!io::ReadAll(reader.descriptor,
+                   std::as_writable_bytes(std::span(reader.chunk)))) {
+    return Fail(reader, ErrorCode::kIoError);
+  }
+  if (io::Checksum(reader.chunk) != header.checksum) {
+    return Fail(reader, ErrorCode::kChecksumMismatch);
+  }
+  reader.total_limbs += header.count;
+  return reader.chunk;
+}
+
+BigFloat
+ReadStream(int descriptor) noexcept {
+  StreamReader reader = MakeStreamReader(descriptor);
+  BigUInt mantissa;
+  for (std::span<const uint64_t> chunk = ReadChunk(reader); !chunk.empty();
+       chunk = ReadChunk(reader)) {
+    mantissa.limbs.insert(mantissa.limbs.end(), chunk.begin(), chunk.end());
+  }
+  if (!IsOk(reader.error)) {
+    return MakeNan(GetPositive(), reader.error);
+  }
+
+  switch (reader.type) {
+    case Type::kZero:
+      return MakeZero(reader.sign, reader.value_error);
+    case Type::kInf:
+      return MakeInf(reader.sign, reader.value_error);
+    case Type::kNan:
+      return MakeNan(reader.sign, reader.value_error);
+    case Type::kDefault:
+      return MakeBigFloat(std::move(mantissa), reader.exp, reader.sign,
+                          Type::kDefault, reader.value_error);
+  }
+}
+
+}  // namespace big_float
@@ -1,11 +1,18 @@
+#include <algorithm>
+#include <compare>
 #include <cstddef>
 #include <cstdlib>
+#include <utility>
 
 #include "big_float.hpp"
+#include "big_float_view.hpp"
 #include "big_uint.hpp"
+#include "budget.hpp"
+#include "builders.hpp"
 #include "error.hpp"
 #include "exponent.hpp"
 #include "getters.hpp"
+#include "limbs.hpp"
 #include "sign.hpp"
 #include "type.hpp"
 
@@ -15,98 +22,78 @@ namespace big_float {
 namespace {
 
 BigFloat
-SubNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+SubNonSpecial(const BigFloatView& lhs, const BigFloatView& rhs) noexcept {
   if (!IsEqual(GetSign(lhs), GetSign(rhs))) {
     return Add(lhs, Neg(rhs));
   }
+  if (!FitsMemoryBudget(GetAlignedSize(lhs, rhs))) {
+    return MakeOverBudget();
+  }
 
   const Exponent kLhsExp = GetExponent(lhs);
   const Exponent kRhsExp = GetExponent(rhs);
-  const BigUInt& lhs_mantissa = GetMantissa(lhs);
-  const BigUInt& rhs_mantissa = GetMantissa(rhs);
-
-  BigUInt result_mantissa;
-  Exponent result_exponent = kLhsExp;  // NOLINT
-  Sign result_sign = GetSign(lhs);
-
-  if (kLhsExp == kRhsExp) {
-    if (big_uint::isEqual(lhs_mantissa, rhs_mantissa)) {
-      return MakeZero();
-    }
-    if (big_uint::isGreater(lhs_mantissa, rhs_mantissa)) {
-      result_mantissa = big_uint::sub(lhs_mantissa, rhs_mantissa);
-    } else {
-      result_mantissa = big_uint::sub(rhs_mantissa, lhs_mantissa);
-      result_sign = Invert(result_sign);
-    }
-    result_exponent = kLhsExp;
-  } else if (kLhsExp > kRhsExp) {
-    const auto kShift = static_cast<size_t>(kLhsExp - kRhsExp);
-    if (big_uint::isGreater(lhs_mantissa, rhs_mantissa) ||
-        big_uint::isEqual(lhs_mantissa, rhs_mantissa)) {
-      result_mantissa = big_uint::sub(lhs_mantissa, rhs_mantissa, kShift);
-    } else {
-      result_mantissa = big_uint::sub(rhs_mantissa, lhs_mantissa, kShift);
-      result_sign = Invert(result_sign);
-    }
-    result_exponent = kRhsExp;
-  } else {
-    const auto kShift = static_cast<size_t>(kRhsExp - kLhsExp);
-    if (big_uint::isGreater(rhs_mantissa, lhs_mantissa) ||
-        big_uint::isEqual(rhs_mantissa, lhs_mantissa)) {
-      result_mantissa = big_uint::sub(rhs_mantissa, lhs_mantissa, kShift);
-      result_sign = Invert(result_sign);
-    } else {
-      result_mantissa = big_uint::sub(lhs_mantissa, rhs_mantissa, kShift);
-    }
-    result_exponent = kLhsExp;
-  }
-
-  if (big_uint::isZero(result_mantissa)) {
+  const Exponent kResultExponent = std::min(kLhsExp, kRhsExp);
+  limbs::Difference difference = limbs::SubMagnitudes(
+      GetLimbs(lhs), static_cast<size_t>(kLhsExp - kResultExponent),
+      GetLimbs(rhs), static_cast<size_t>(kRhsExp - kResultExponent));
+  if (difference.order == std::strong_ordering::equal) {
     return MakeZero();
   }
 
-  return MakeBigFloat(result_mantissa, result_exponent, result_sign,
-                      Type::kDefault, GetDefaultError());
+  BigUInt result_mantissa;
+  result_mantissa.limbs = std::move(difference.magnitude);
+  const Sign kResultSign = difference.order == std::strong_ordering::greater
+                               ? GetSign(lhs)
+                               : Invert(GetSign(lhs));
+  return MakeBigFloat(std::move(result_mantissa), kResultExponent,
+                      kResultSign, Type::kDefault, GetDefaultError());
+}
+
+BigFloat
+SubNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+  return SubNonSpecial(MakeView(lhs), MakeView(rhs));
 }
 
+template <typename Number>
 BigFloat
-SubSpecialFromNonSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+SubSpecialFromNonSpecial(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kInf:
-      return Neg(rhs);
+      return ToBigFloat(Neg(rhs));
     case Type::kZero:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kDefault:
       return SubNonSpecial(lhs, rhs);
   }
 }
 
+template <typename Number>
 BigFloat
-SubFromInf(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+SubFromInf(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(rhs)) {
     case Type::kNan:
-      return rhs;
+      return ToBigFloat(rhs);
     case Type::kZero:
     case Type::kDefault:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kInf:
       const bool kIsEqualBySign = IsEqual(GetSign(lhs), GetSign(rhs));
-      return kIsEqualBySign ? MakeNan() : lhs;
+      return kIsEqualBySign ? MakeNan() : ToBigFloat(lhs);
   }
 }
 
+template <typename Number>
 BigFloat
-SubSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
+SubSpecial(const Number& lhs, const Number& rhs) noexcept {
   switch (GetType(lhs)) {
     case Type::kNan:
-      return lhs;
+      return ToBigFloat(lhs);
     case Type::kInf:
       return SubFromInf(lhs, rhs);
     case Type::kZero:
-      return Neg(rhs);
+      return ToBigFloat(Neg(rhs));
     case Type::kDefault:
       return SubSpecialFromNonSpecial(lhs, rhs);
   }
@@ -116,6 +103,14 @@ SubSpecial(const BigFloat& lhs, const BigFloat& rhs) noexcept {
 
 BigFloat
 Sub(const BigFloat& minuend, const BigFloat& subtrahend) noexcept {
+  if (HasSpecial(minuend, subtrahend)) {
+    return SubSpecial(minuend, subtrahend);
+  }
+  return SubNonSpecial(minuend, subtrahend);
+}
+
+BigFloat
+Sub(const BigFloatView& minuend, const BigFloatView& subtrahend) noexcept {
   if (IsSpecial(minuend) || IsSpecial(subtrahend)) {
     return SubSpecial(minuend, subtrahend);
   }
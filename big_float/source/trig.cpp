@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "big_float.hpp"
+#include "builders.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+namespace big_float {
+namespace {
+
+constexpr Precision kGuardBits = 64;
+constexpr int64_t kMaxReductionRetries = 8;
+constexpr uint64_t kQuadrants = 4;
+
+struct Reduction {  // NOLINT
+  BigFloat remainder;
+  uint64_t quadrant;
+};
+
+uint64_t
+GetQuadrant(const BigFloat& integer) noexcept {
+  const limbs::LimbSpan kLimbs = GetLimbs(integer);
+  const Exponent kExponent = GetExponent(integer);
+  if (IsZero(integer) || kExponent > 0 ||
+      static_cast<size_t>(-kExponent) >= kLimbs.size()) {
+    return 0;
+  }
+  const uint64_t kResidue =
+      kLimbs[static_cast<size_t>(-kExponent)] % kQuadrants;
+  return IsNegative(integer) ? (kQuadrants - kResidue) % kQuadrants
+                             : kResidue;
+}
+
+// x = k pi / 2 + r with |r| <= pi / 4. The remainder keeps `working`
+// significant bits even when x sits next to a multiple of pi / 2.
+Reduction
+ReduceQuarterTurns(const BigFloat& angle, Precision working) noexcept {
+  const int64_t kLeading = std::max<int64_t>(GetLeadingBit(angle), 0);
+  const auto kIntegerBits = static_cast<Precision>(kLeading) + kGuardBits;
+  const BigFloat kPiEstimate = GetConstant(Constant::kPi, kIntegerBits);
+  const BigFloat kTurns =
+      Div(Scale(angle, 1), kPiEstimate, kIntegerBits + kGuardBits);
+  const BigFloat kHalf = MakeScaled(1, -1, GetSign(angle));
+  const BigFloat kNearest = TruncateFraction(Add(kTurns, kHalf), 0);
+  if (IsZero(kNearest)) {
+    return {.remainder = angle, .quadrant = 0};
+  }
+
+  Precision extra = 0;
+  BigFloat remainder;
+  for (int64_t retry = 0; retry < kMaxReductionRetries; ++retry) {
+    const Precision kBits = working + kIntegerBits + extra;
+    const BigFloat kQuarter = Scale(GetConstant(Constant::kPi, kBits), -1);
+    remainder = TruncateFraction(Sub(angle, Mul(kNearest, kQuarter)),
+                                 static_cast<int64_t>(working + extra));
+    const int64_t kLost = IsZero(remainder) ? static_cast<int64_t>(kBits)
+                                            : -GetLeadingBit(remainder);
+    if (kLost <= static_cast<int64_t>(extra + kGuardBits / 2)) {
+      break;
+    }
+    extra = static_cast<Precision>(kLost) + kGuardBits;
+  }
+  return {.remainder = remainder, .quadrant = GetQuadrant(kNearest)};
+}
+
+// Number of terms with |y| < 2^-magnitude and y = r^2: the term
+// y^n / (2n)! must drop below 2^-precision.
+uint64_t
+CountTerms(int64_t magnitude, Precision precision) noexcept {
+  const auto kPrecision = static_cast<int64_t>(precision);
+  uint64_t terms = 1;
+  for (int64_t bits = 0; bits <= kPrecision; ++terms) {
+    bits += magnitude + 2 * static_cast<int64_t>(std::bit_width(terms));
+  }
+  return terms;
+}
+
+// sum_k (-y)^k / (2k + offset)! by rectangular splitting: blocks of
+// `powers.size()` terms share the precomputed powers y^0 .. y^(m - 1), so
+// inside a block only multiplications by small integers are needed and the
+// number of full-width products is about 2 sqrt(terms).
+BigFloat
+SumAlternating(const std::vector<BigFloat>& powers, const BigFloat& step,
+               uint64_t terms, uint64_t offset, Precision working) noexcept {
+  const uint64_t kBlock = powers.size();
+  const auto kFactor = [offset](uint64_t index) {
+    return (2 * index + offset - 1) * (2 * index + offset);
+  };
+
+  BigFloat sum = MakeZero();
+  for (uint64_t begin = (terms - 1) / kBlock * kBlock;; begin -= kBlock) {
+    BigFloat accumulated = MakeZero();
+    BigFloat multiplier = MakeInteger(1);
+    const uint64_t kEnd = std::min(begin + kBlock, terms);
+    for (uint64_t index = kEnd; index-- > begin;) {
+      const BigFloat kTerm = Mul(powers[index - begin], multiplier);
+      accumulated = (index - begin) % 2 == 0 ? Add(accumulated, kTerm)
+                                             : Sub(accumulated, kTerm);
+      if (index > begin) {
+        multiplier = Mul(multiplier, kFactor(index));
+      }
+    }
+    if (kEnd < terms) {
+      const BigFloat kCarried = Div(Mul(step, sum), kFactor(begin + kBlock),
+                                    working);
+      accumulated = kBlock % 2 == 0 ? Add(accumulated, kCarried)
+                                    : Sub(accumulated, kCarried);
+    }
+    sum = Div(accumulated, multiplier, working);
+    if (begin == 0) {
+      return sum;
+    }
+  }
+}
+
+// sin and cos of |r| <= pi / 4: halve `halvings` times, sum both series on
+// shared powers of r^2, then apply the double-angle formulas.
+SineCosine
+SinCosReduced(const BigFloat& remainder, Precision precision) noexcept {
+  const auto kHalvings =
+      static_cast<int64_t>(std::sqrt(static_cast<double>(precision)) / 2);
+  const Precision kWorking =
+      precision + kGuardBits + 2 * static_cast<Precision>(kHalvings);
+  const BigFloat kAngle = Scale(remainder, -kHalvings);
+  const BigFloat kSquare = Truncate(Sqr(kAngle), kWorking);
+
+  const uint64_t kTerms = CountTerms(-GetLeadingBit(kSquare), kWorking);
+  const auto kBlock = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::sqrt(static_cast<double>(kTerms))));
+  std::vector<BigFloat> powers = {MakeInteger(1)};
+  while (powers.size() < kBlock) {
+    powers.push_back(Truncate(Mul(powers.back(), kSquare), kWorking));
+  }
+  const BigFloat kStep = Truncate(Mul(powers.back(), kSquare), kWorking);
+
+  BigFloat sine = Truncate(
+      Mul(kAngle, SumAlternating(powers, kStep, kTerms, 1, kWorking)),
+      kWorking);
+  BigFloat cosine = SumAlternating(powers, kStep, kTerms, 0, kWorking);
+  const BigFloat kOne = MakeInteger(1);
+  for (int64_t step = 0; step < kHalvings; ++step) {
+    const BigFloat kSineSquare = Sqr(sine);
+    sine = Truncate(Scale(Mul(sine, cosine), 1), kWorking);
+    cosine = Truncate(Sub(kOne, Scale(kSineSquare, 1)), kWorking);
+  }
+  return {.sin = std::move(sine), .cos = std::move(cosine)};
+}
+
+SineCosine
+SinCosNonSpecial(const BigFloat& angle, Precision precision) noexcept {
+  const Reduction kReduction =
+      ReduceQuarterTurns(angle, precision + kGuardBits);
+  if (IsZero(kReduction.remainder)) {
+    return {.sin = kReduction.remainder, .cos = MakeInteger(1)};
+  }
+  const SineCosine kReduced = SinCosReduced(kReduction.remainder, precision);
+  BigFloat sine = Truncate(kReduced.sin, precision);
+  BigFloat cosine = Truncate(kReduced.cos, precision);
+  switch (kReduction.quadrant) {
+    case 1:
+      return {.sin = std::move(cosine), .cos = Neg(sine)};
+    case 2:
+      return {.sin = Neg(sine), .cos = Neg(cosine)};
+    case 3:
+      return {.sin = Neg(cosine), .cos = std::move(sine)};
+    default:
+      return {.sin = std::move(sine), .cos = std::move(cosine)};
+  }
+}
+
+SineCosine
+SinCosSpecial(const BigFloat& angle) noexcept {
+  switch (GetType(angle)) {
+    case Type::kNan:
+      return {.sin = angle, .cos = angle};
+    case Type::kZero:
+      return {.sin = angle, .cos = MakeInteger(1)};
+    case Type::kInf:
+    case Type::kDefault:
+      return {.sin = MakeNan(), .cos = MakeNan()};
+  }
+}
+
+}  // namespace
+
+SineCosine
+SinCos(const BigFloat& angle, Precision precision) noexcept {
+  if (IsSpecial(angle)) {
+    return SinCosSpecial(angle);
+  }
+  return SinCosNonSpecial(angle, precision);
+}
+
+BigFloat
+Sin(const BigFloat& angle, Precision precision) noexcept {
+  return SinCos(angle, precision).sin;
+}
+
+BigFloat
+Cos(const BigFloat& angle, Precision precision) noexcept {
+  return SinCos(angle, precision).cos;
+}
+
+BigFloat
+Tan(const BigFloat& angle, Precision precision) noexcept {
+  const SineCosine kSinCos = SinCos(angle, precision + kGuardBits);
+  if (IsSpecial(kSinCos.sin)) {
+    return kSinCos.sin;
+  }
+  return Div(kSinCos.sin, kSinCos.cos, precision);
+}
+
+}  // namespace big_float
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "getters.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_uint::BigUInt;
+
+namespace big_float {
+
+BigFloatView
+MakeView(const BigFloat& number) noexcept {
+  return MakeView(GetLimbs(number), GetExponent(number), GetSign(number),
+                  GetType(number), GetError(number));
+}
+
+BigFloatView
+MakeView(std::span<const uint64_t> limbs, Exponent exp, Sign sign, Type type,
+         Error error) noexcept {
+  return {.limbs = limbs,
+          .exp = exp,
+          .type = type,
+          .sign = sign,
+          .error = error};
+}
+
+BigFloat
+ToBigFloat(const BigFloatView& view) noexcept {
+  const limbs::LimbSpan kLimbs = GetLimbs(view);
+  BigUInt mantissa;
+  mantissa.limbs.assign(kLimbs.begin(), kLimbs.end());
+  return MakeBigFloat(std::move(mantissa), GetExponent(view), GetSign(view),
+                      GetType(view), GetError(view));
+}
+
+BigFloat
+ToBigFloat(BigFloat number) noexcept {
+  return number;
+}
+
+BigFloatView
+Abs(const BigFloatView& view) noexcept {
+  return MakeView(GetLimbs(view), GetExponent(view), GetPositive(),
+                  GetType(view), GetError(view));
+}
+
+BigFloatView
+Neg(const BigFloatView& view) noexcept {
+  return MakeView(GetLimbs(view), GetExponent(view), Invert(GetSign(view)),
+                  GetType(view), GetError(view));
+}
+
+}  // namespace big_float
@@ -0,0 +1,125 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "accumulator.hpp"
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::BigFloatAccumulator;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsNan;
+using big_float::IsZero;
+using big_float::MakeAccumulator;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeView;
+using big_float::MakeZero;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sub;
+using big_float::ToBigFloat;
+using big_float::Truncate;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kOne = 1;
+constexpr uint64_t kTwo = 2;
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kAllOnes = std::numeric_limits<uint64_t>::max();
+constexpr size_t kTermCount = 1000;
+constexpr Exponent kSpread = 7;
+constexpr Precision kPrecision = 64;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+}  // namespace
+
+class AccumulatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override { sum_ = MakeAccumulator(); }
+
+  BigFloatAccumulator sum_;
+};
+
+TEST_F(AccumulatorTest, EmptySumIsZero) {
+  EXPECT_TRUE(IsZero(ToBigFloat(sum_)));
+}
+
+TEST_F(AccumulatorTest, MatchesChainedAdd) {
+  BigFloat expected = MakeZero();
+  for (size_t index = 0; index < kTermCount; ++index) {
+    const auto kExp = static_cast<Exponent>(index) % kSpread - kSpread / 2;
+    const BigFloat kTerm =
+        MakeNumber({kAllOnes - index, kAllOnes}, kExp, index % 3 == 0);
+    Add(sum_, kTerm);
+    expected = Add(expected, kTerm);
+  }
+
+  EXPECT_TRUE(IsEqual(ToBigFloat(sum_), expected));
+}
+
+TEST_F(AccumulatorTest, ResolvesNegativeSum) {
+  Add(sum_, MakeNumber({kOne}));
+  Sub(sum_, MakeView(MakeNumber({kThree})));
+
+  EXPECT_TRUE(IsEqual(ToBigFloat(sum_), MakeNumber({kTwo}, 0, true)));
+
+  Sub(sum_, MakeNumber({kTwo}, 0, true));
+
+  EXPECT_TRUE(IsZero(ToBigFloat(sum_)));
+}
+
+TEST_F(AccumulatorTest, GrowsInBothDirections) {
+  Add(sum_, MakeNumber({kOne}, 2));
+  Add(sum_, MakeNumber({kOne}, -2));
+  Sub(sum_, MakeNumber({kOne}, 0));
+
+  EXPECT_TRUE(
+      IsEqual(ToBigFloat(sum_), MakeNumber({kOne, 0, kAllOnes, kAllOnes}, -2)));
+  EXPECT_TRUE(IsEqual(Truncate(sum_, kPrecision), MakeNumber({kAllOnes}, 1)));
+}
+
+TEST_F(AccumulatorTest, SpecialTerms) {
+  Add(sum_, MakeNumber({kOne}));
+  Add(sum_, MakeInf(GetNegative()));
+
+  EXPECT_TRUE(IsInf(ToBigFloat(sum_)));
+  EXPECT_TRUE(IsEqual(ToBigFloat(sum_), MakeInf(GetNegative())));
+
+  Sub(sum_, MakeInf(GetNegative()));
+
+  EXPECT_TRUE(IsNan(ToBigFloat(sum_)));
+
+  BigFloatAccumulator other = MakeAccumulator();
+  Add(other, MakeNan());
+
+  EXPECT_TRUE(IsNan(ToBigFloat(other)));
+}
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -9,6 +10,7 @@
 #include "sign.hpp"
 #include "type.hpp"
 
+using big_float::Abs;
 using big_float::Add;
 using big_float::BigFloat;
 using big_float::Exponent;
@@ -21,6 +23,7 @@ using big_float::MakeBigFloat;
 using big_float::MakeInf;
 using big_float::MakeNan;
 using big_float::MakeZero;
+using big_float::Neg;
 using big_float::Sign;
 using big_float::Type;
 
@@ -277,3 +280,21 @@ TEST_F(AddTest, CommutativeWithZero) {
 
   EXPECT_TRUE(IsEqual(result1, result2));
 }
+
+TEST_F(AddTest, SpecialValuesHaveNoMantissa) {
+  EXPECT_TRUE(pos_zero_.number.limbs.empty());
+  EXPECT_TRUE(neg_inf_.number.limbs.empty());
+  EXPECT_TRUE(pos_nan_.number.limbs.empty());
+}
+
+TEST_F(AddTest, NegOfTemporaryKeepsMantissa) {
+  BigFloat number = large_pos_;
+  const uint64_t* limbs = number.number.limbs.data();
+
+  BigFloat negated = Neg(std::move(number));
+  BigFloat restored = Abs(std::move(negated));
+
+  EXPECT_EQ(restored.number.limbs.data(), limbs);
+  EXPECT_TRUE(IsEqual(restored, large_pos_));
+  EXPECT_TRUE(IsEqual(Neg(large_pos_), large_neg_));
+}
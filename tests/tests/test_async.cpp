@@ -0,0 +1,194 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "async.hpp"
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "error.hpp"
+#include "executor.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::AsyncOptions;
+using big_float::BigFloat;
+using big_float::Cancel;
+using big_float::CancelToken;
+using big_float::ComputePi;
+using big_float::ComputePiAsync;
+using big_float::Div;
+using big_float::DivAsync;
+using big_float::ErrorCode;
+using big_float::Exp;
+using big_float::Executor;
+using big_float::ExpAsync;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetError;
+using big_float::GetErrorCode;
+using big_float::GetExecutor;
+using big_float::GetPositive;
+using big_float::IsCancelled;
+using big_float::IsEqual;
+using big_float::IsNan;
+using big_float::MakeBigFloat;
+using big_float::MakeCancelToken;
+using big_float::MakeThreadPool;
+using big_float::Precision;
+using big_float::SetExecutor;
+using big_float::Type;
+
+namespace {
+
+constexpr size_t kDivisorLimbs = 128;
+constexpr uint64_t kLimbPattern = 0x9E3779B97F4A7C15;
+constexpr Precision kDivPrecision = 16384;
+constexpr Precision kExpPrecision = 8192;
+constexpr Precision kPiPrecision = 65536;
+constexpr size_t kPoolThreads = 2;
+constexpr auto kCancelWait = std::chrono::seconds(10);
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+  return MakeBigFloat(mantissa, exp, GetPositive(), Type::kDefault,
+                      GetDefaultError());
+}
+
+ErrorCode
+GetCode(const BigFloat& number) {
+  return GetErrorCode(GetError(number));
+}
+
+}  // namespace
+
+class AsyncTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dividend_ = MakeNumber({kLimbPattern, 1});
+    divisor_ = MakeNumber(std::vector<uint64_t>(kDivisorLimbs, kLimbPattern),
+                          -static_cast<Exponent>(kDivisorLimbs));
+    exponent_ = MakeNumber({kLimbPattern}, -1);
+    options_.progress = [this](uint64_t done, uint64_t total) {
+      total_.store(total);
+      if (done == total) {
+        is_complete_.store(true);
+      }
+    };
+  }
+
+  BigFloat dividend_, divisor_, exponent_;
+  AsyncOptions options_;
+  std::atomic<uint64_t> total_ = 0;
+  std::atomic<bool> is_complete_ = false;
+};
+
+TEST_F(AsyncTest, DivMatchesSync) {
+  const BigFloat kQuotient =
+      DivAsync(dividend_, divisor_, kDivPrecision, options_).get();
+
+  EXPECT_TRUE(IsEqual(kQuotient, Div(dividend_, divisor_, kDivPrecision)));
+  EXPECT_GT(total_.load(), 1);
+  EXPECT_TRUE(is_complete_.load());
+}
+
+TEST_F(AsyncTest, ExpMatchesSync) {
+  const BigFloat kResult = ExpAsync(exponent_, kExpPrecision, options_).get();
+
+  EXPECT_TRUE(IsEqual(kResult, Exp(exponent_, kExpPrecision)));
+  EXPECT_TRUE(is_complete_.load());
+}
+
+TEST_F(AsyncTest, CancelledBeforeStart) {
+  options_.token = MakeCancelToken();
+  Cancel(options_.token);
+
+  const BigFloat kQuotient =
+      DivAsync(dividend_, divisor_, kDivPrecision, options_).get();
+
+  EXPECT_TRUE(IsNan(kQuotient));
+  EXPECT_EQ(GetCode(kQuotient), ErrorCode::kCancelled);
+  EXPECT_FALSE(is_complete_.load());
+}
+
+TEST_F(AsyncTest, CancelledFromProgress) {
+  const CancelToken kToken = MakeCancelToken();
+  options_.token = kToken;
+  options_.progress = [kToken](uint64_t /*done*/, uint64_t /*total*/) {
+    Cancel(kToken);
+  };
+
+  const BigFloat kPi = ComputePiAsync(kPiPrecision, options_).get();
+
+  EXPECT_TRUE(IsCancelled(kToken));
+  EXPECT_EQ(GetCode(kPi), ErrorCode::kCancelled);
+}
+
+TEST_F(AsyncTest, DeadlineExceeded) {
+  options_.deadline = std::chrono::steady_clock::now();
+
+  const BigFloat kResult = ExpAsync(exponent_, kExpPrecision, options_).get();
+
+  EXPECT_TRUE(IsNan(kResult));
+  EXPECT_EQ(GetCode(kResult), ErrorCode::kDeadlineExceeded);
+}
+
+TEST_F(AsyncTest, PiMatchesSync) {
+  options_.token = MakeCancelToken();
+  options_.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+  const BigFloat kPi = ComputePiAsync(kPiPrecision, options_).get();
+
+  EXPECT_TRUE(IsEqual(kPi, ComputePi(kPiPrecision)));
+  EXPECT_TRUE(is_complete_.load());
+}
+
+TEST_F(AsyncTest, ExecutorSwappedWhilePiRuns) {
+  const std::shared_ptr<const Executor> kSaved = GetExecutor();
+  SetExecutor(MakeThreadPool(kPoolThreads));
+
+  std::future<BigFloat> pi = ComputePiAsync(kPiPrecision, options_);
+  while (total_.load() == 0) {
+    std::this_thread::yield();
+  }
+  SetExecutor(MakeThreadPool(1));
+  const BigFloat kPi = pi.get();
+  SetExecutor(*kSaved);
+
+  EXPECT_TRUE(IsEqual(kPi, ComputePi(kPiPrecision)));
+}
+
+TEST_F(AsyncTest, InlineExecutorStillReturnsEarly) {
+  const std::shared_ptr<const Executor> kSaved = GetExecutor();
+  SetExecutor(MakeThreadPool(0));
+  const CancelToken kToken = MakeCancelToken();
+  options_.token = kToken;
+  const auto kGiveUp = std::chrono::steady_clock::now() + kCancelWait;
+  options_.progress = [kToken, kGiveUp](uint64_t /*done*/,
+                                        uint64_t /*total*/) {
+    while (!IsCancelled(kToken) &&
+           std::chrono::steady_clock::now() < kGiveUp) {
+      std::this_thread::yield();
+    }
+  };
+
+  std::future<BigFloat> pi = ComputePiAsync(kPiPrecision, options_);
+  Cancel(kToken);
+  const BigFloat kPi = pi.get();
+  SetExecutor(*kSaved);
+
+  EXPECT_EQ(GetCode(kPi), ErrorCode::kCancelled);
+}
@@ -0,0 +1,141 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "budget.hpp"
+#include "error.hpp"
+#include "executor.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Div;
+using big_float::ErrorCode;
+using big_float::Executor;
+using big_float::Exponent;
+using big_float::FitsMemoryBudget;
+using big_float::ForkJoin;
+using big_float::GetDefaultError;
+using big_float::GetError;
+using big_float::GetErrorCode;
+using big_float::GetExecutor;
+using big_float::GetMemoryBudget;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsNan;
+using big_float::MakeBigFloat;
+using big_float::MakeParallelism;
+using big_float::MakeThreadPool;
+using big_float::MakeView;
+using big_float::Mul;
+using big_float::Precision;
+using big_float::SetExecutor;
+using big_float::SetMemoryBudget;
+using big_float::Sqr;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+constexpr size_t kBudget = 1024;
+constexpr size_t kBudgetLimbs = kBudget / sizeof(uint64_t);
+constexpr size_t kWideLimbs = 100;
+constexpr Exponent kFarExponent = Exponent{1} << 40;
+constexpr Precision kLargePrecision = 1 << 20;
+constexpr size_t kPoolThreads = 2;
+constexpr uint64_t kLimb = 3;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+  return MakeBigFloat(mantissa, exp, GetPositive(), Type::kDefault,
+                      GetDefaultError());
+}
+
+bool
+IsOverBudget(const BigFloat& number) {
+  return IsNan(number) &&
+         GetErrorCode(GetError(number)) == ErrorCode::kMemoryBudgetExceeded;
+}
+
+}  // namespace
+
+class BudgetTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    near_ = MakeNumber({kLimb});
+    far_ = MakeNumber({kLimb}, kFarExponent);
+    wide_ = MakeNumber(std::vector<uint64_t>(kWideLimbs, kLimb));
+    SetMemoryBudget(kBudget);
+  }
+
+  void TearDown() override { SetMemoryBudget(0); }
+
+  BigFloat near_, far_, wide_;
+};
+
+TEST_F(BudgetTest, ChecksLimbCount) {
+  EXPECT_TRUE(FitsMemoryBudget(kBudgetLimbs));
+  EXPECT_FALSE(FitsMemoryBudget(kBudgetLimbs + 1));
+
+  SetMemoryBudget(0);
+
+  EXPECT_EQ(GetMemoryBudget(), 0);
+  EXPECT_TRUE(FitsMemoryBudget(~uint64_t{0}));
+}
+
+TEST_F(BudgetTest, ExponentGapFailsBeforeAllocating) {
+  EXPECT_TRUE(IsOverBudget(Add(near_, far_)));
+  EXPECT_TRUE(IsOverBudget(Sub(far_, near_)));
+  EXPECT_TRUE(IsOverBudget(Add(MakeView(far_), MakeView(near_))));
+  EXPECT_TRUE(IsEqual(Sub(Add(near_, near_), near_), near_));
+}
+
+TEST_F(BudgetTest, ProductsAndQuotients) {
+  EXPECT_TRUE(IsOverBudget(Mul(wide_, Add(wide_, near_))));
+  EXPECT_TRUE(IsOverBudget(Sqr(wide_)));
+  EXPECT_TRUE(IsOverBudget(Div(near_, wide_, kLargePrecision)));
+  EXPECT_FALSE(IsNan(Mul(wide_, near_)));
+  EXPECT_FALSE(IsNan(Div(wide_, near_)));
+}
+
+TEST_F(BudgetTest, ScalarProductsAndQuotients) {
+  const BigFloat kFull = MakeNumber(std::vector<uint64_t>(kBudgetLimbs, kLimb));
+
+  EXPECT_TRUE(IsOverBudget(Mul(kFull, uint64_t{kLimb})));
+  EXPECT_TRUE(IsOverBudget(Div(near_, uint64_t{kLimb}, kLargePrecision)));
+  EXPECT_FALSE(IsNan(Mul(wide_, uint64_t{kLimb})));
+  EXPECT_FALSE(IsNan(Div(wide_, uint64_t{kLimb})));
+}
+
+TEST_F(BudgetTest, ErrorPropagates) {
+  const BigFloat kProduct = Mul(Add(near_, far_), wide_);
+
+  EXPECT_TRUE(IsOverBudget(kProduct));
+}
+
+TEST_F(BudgetTest, ForkedWorkInheritsBudget) {
+  const std::shared_ptr<const Executor> kSaved = GetExecutor();
+  SetExecutor(MakeThreadPool(kPoolThreads));
+  size_t left = 0;
+  size_t right = 0;
+
+  ForkJoin(
+      MakeParallelism(1, 0), 1, [&] { left = GetMemoryBudget(); },
+      [&] { right = GetMemoryBudget(); });
+  SetExecutor(*kSaved);
+
+  EXPECT_EQ(left, kBudget);
+  EXPECT_EQ(right, kBudget);
+}
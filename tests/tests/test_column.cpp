@@ -0,0 +1,298 @@
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "column.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Column;
+using big_float::ColumnAccess;
+using big_float::ErrorCode;
+using big_float::Exponent;
+using big_float::GetCount;
+using big_float::GetDefaultError;
+using big_float::GetError;
+using big_float::GetErrorCode;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::GetSign;
+using big_float::GetView;
+using big_float::IsEqual;
+using big_float::IsGreater;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsOk;
+using big_float::IsZero;
+using big_float::kMaxExponent;
+using big_float::kMinExponent;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeView;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::OpenColumn;
+using big_float::Sign;
+using big_float::Sub;
+using big_float::ToBigFloat;
+using big_float::Type;
+using big_float::WriteColumn;
+using big_float::WriteProduct;
+
+namespace {
+
+constexpr uint64_t kSmallNumber = 100;
+constexpr uint64_t kLargeNumber = 200;
+constexpr uint64_t kMaxLimb = ~uint64_t{0};
+constexpr Exponent kLargeExponent = 3;
+constexpr size_t kWideLimbs = 80;
+constexpr size_t kOddLimbs = 37;
+constexpr uint64_t kLimbPattern = 0x9E3779B97F4A7C15;
+constexpr std::streamoff kFirstErrorOffset = 42;
+constexpr char kUnknownErrorCode = 0x7F;
+constexpr std::array<size_t, 4> kBlockLimbs = {1, 3, 16, 200};
+constexpr std::array<std::pair<size_t, size_t>, 4> kProductOperands = {
+    {{3, 7}, {7, 2}, {3, 3}, {7, 7}}};
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+std::string
+MakeTempPath() {
+  const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+  const std::string kName =
+      std::string("big_float_") + info->name() + ".column";
+  return (std::filesystem::temp_directory_path() / kName).string();
+}
+
+}  // namespace
+
+class ColumnTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::vector<uint64_t> wide(kWideLimbs, kMaxLimb);
+    numbers_ = {
+        MakeNumber({kSmallNumber}),
+        MakeNumber({kLargeNumber}, 0, true),
+        MakeNumber({kMaxLimb, kSmallNumber}, kLargeExponent),
+        MakeNumber(wide),
+        MakeZero(GetNegative()),
+        MakeInf(GetPositive()),
+        MakeNan(),
+    };
+    path_ = MakeTempPath();
+    ASSERT_TRUE(IsOk(WriteColumn(path_, numbers_)));
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  std::vector<BigFloat> numbers_;
+  std::string path_;
+};
+
+TEST_F(ColumnTest, OpenReportsCount) {
+  Column column = OpenColumn(path_);
+
+  EXPECT_TRUE(IsOk(GetError(column)));
+  EXPECT_EQ(GetCount(column), numbers_.size());
+}
+
+TEST_F(ColumnTest, ViewsMatchWrittenNumbers) {
+  Column column = OpenColumn(path_);
+
+  for (size_t index = 0; index < 4; ++index) {
+    EXPECT_TRUE(IsEqual(GetView(column, index), MakeView(numbers_[index])));
+  }
+}
+
+TEST_F(ColumnTest, SpecialValuesSurvive) {
+  Column column = OpenColumn(path_);
+
+  BigFloat zero = ToBigFloat(GetView(column, 4));
+  BigFloat inf = ToBigFloat(GetView(column, 5));
+  BigFloat nan = ToBigFloat(GetView(column, 6));
+
+  EXPECT_TRUE(IsZero(zero));
+  EXPECT_EQ(GetSign(zero), GetNegative());
+  EXPECT_TRUE(IsInf(inf));
+  EXPECT_TRUE(IsNan(nan));
+}
+
+TEST_F(ColumnTest, CompareViews) {
+  Column column = OpenColumn(path_);
+
+  EXPECT_TRUE(IsGreater(GetView(column, 0), GetView(column, 1)));
+  EXPECT_TRUE(IsLower(GetView(column, 0), GetView(column, 2)));
+  EXPECT_TRUE(IsLower(GetView(column, 3), GetView(column, 5)));
+  EXPECT_FALSE(IsEqual(GetView(column, 6), GetView(column, 6)));
+}
+
+TEST_F(ColumnTest, AddViewsMatchesOwning) {
+  Column column = OpenColumn(path_);
+
+  for (size_t lhs = 0; lhs < numbers_.size(); ++lhs) {
+    for (size_t rhs = 0; rhs < numbers_.size(); ++rhs) {
+      BigFloat expected = Add(numbers_[lhs], numbers_[rhs]);
+      BigFloat result = Add(GetView(column, lhs), GetView(column, rhs));
+      EXPECT_EQ(IsNan(result), IsNan(expected));
+      EXPECT_TRUE(IsNan(expected) || IsEqual(result, expected));
+    }
+  }
+}
+
+TEST_F(ColumnTest, SubViews) {
+  Column column = OpenColumn(path_);
+  BigFloat expected = MakeNumber({kSmallNumber + kLargeNumber});
+
+  BigFloat result = Sub(GetView(column, 0), GetView(column, 1));
+
+  EXPECT_TRUE(IsEqual(result, expected));
+}
+
+TEST_F(ColumnTest, MulViewsMatchesOwning) {
+  Column column = OpenColumn(path_);
+
+  for (size_t lhs = 0; lhs < numbers_.size(); ++lhs) {
+    for (size_t rhs = 0; rhs < numbers_.size(); ++rhs) {
+      BigFloat expected = Mul(numbers_[lhs], numbers_[rhs]);
+      BigFloat result = Mul(GetView(column, lhs), GetView(column, rhs));
+      EXPECT_EQ(IsNan(result), IsNan(expected));
+      EXPECT_TRUE(IsNan(expected) || IsEqual(result, expected));
+    }
+  }
+}
+
+TEST_F(ColumnTest, SequentialScan) {
+  Column column = OpenColumn(path_, ColumnAccess::kSequential);
+  BigFloat total = MakeZero();
+
+  for (size_t index = 0; index < 4; ++index) {
+    total = Add(MakeView(total), GetView(column, index));
+  }
+
+  BigFloat expected = MakeZero();
+  for (size_t index = 0; index < 4; ++index) {
+    expected = Add(expected, numbers_[index]);
+  }
+  EXPECT_TRUE(IsEqual(total, expected));
+}
+
+TEST_F(ColumnTest, OutOfRangeIndexIsNan) {
+  Column column = OpenColumn(path_);
+
+  BigFloat result = ToBigFloat(GetView(column, numbers_.size()));
+
+  EXPECT_TRUE(IsNan(result));
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kInvalidFormat);
+}
+
+TEST_F(ColumnTest, UnknownErrorCodeIsInvalidFormat) {
+  std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(kFirstErrorOffset);
+  file.put(kUnknownErrorCode);
+  file.close();
+  Column column = OpenColumn(path_);
+
+  BigFloat result = ToBigFloat(GetView(column, 0));
+
+  EXPECT_TRUE(IsNan(result));
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kInvalidFormat);
+}
+
+TEST_F(ColumnTest, MissingFileReportsIoError) {
+  Column column = OpenColumn(path_ + ".missing");
+
+  EXPECT_EQ(GetErrorCode(GetError(column)), ErrorCode::kIoError);
+}
+
+TEST_F(ColumnTest, CorruptFileReportsInvalidFormat) {
+  std::ofstream(path_, std::ios::binary | std::ios::trunc)
+      << "not a column file, just some text";
+
+  Column column = OpenColumn(path_);
+
+  EXPECT_EQ(GetErrorCode(GetError(column)), ErrorCode::kInvalidFormat);
+}
+
+TEST_F(ColumnTest, ProductMatchesInMemory) {
+  std::vector<uint64_t> odd(kOddLimbs);
+  for (size_t index = 0; index < odd.size(); ++index) {
+    odd[index] = kLimbPattern * (index + 1);
+  }
+  numbers_.push_back(MakeNumber(odd, -kLargeExponent, true));
+  ASSERT_TRUE(IsOk(WriteColumn(path_, numbers_)));
+  Column column = OpenColumn(path_, ColumnAccess::kSequential);
+  const std::string kProductPath = path_ + ".product";
+
+  for (const size_t kBlock : kBlockLimbs) {
+    for (const auto& [lhs, rhs] : kProductOperands) {
+      ASSERT_TRUE(IsOk(WriteProduct(kProductPath, GetView(column, lhs),
+                                    GetView(column, rhs), kBlock)));
+      Column product = OpenColumn(kProductPath);
+
+      EXPECT_TRUE(IsEqual(GetView(product, 0),
+                          MakeView(Mul(numbers_[lhs], numbers_[rhs]))));
+    }
+  }
+  std::filesystem::remove(kProductPath);
+}
+
+TEST_F(ColumnTest, ProductOfSpecialValues) {
+  Column column = OpenColumn(path_);
+  const std::string kProductPath = path_ + ".product";
+
+  ASSERT_TRUE(IsOk(
+      WriteProduct(kProductPath, GetView(column, 4), GetView(column, 5))));
+  EXPECT_TRUE(IsNan(ToBigFloat(GetView(OpenColumn(kProductPath), 0))));
+
+  ASSERT_TRUE(IsOk(
+      WriteProduct(kProductPath, GetView(column, 1), GetView(column, 5))));
+  const BigFloat kInf = ToBigFloat(GetView(OpenColumn(kProductPath), 0));
+  EXPECT_TRUE(IsInf(kInf));
+  EXPECT_EQ(GetSign(kInf), GetNegative());
+
+  EXPECT_EQ(GetErrorCode(WriteProduct(kProductPath, GetView(column, 0),
+                                      GetView(column, 1), 0)),
+            ErrorCode::kError);
+  std::filesystem::remove(kProductPath);
+}
+
+TEST_F(ColumnTest, ProductExponentOutsideRangeSaturates) {
+  const BigFloat kHuge = MakeNumber({kSmallNumber}, kMaxExponent);
+  const BigFloat kTiny = MakeNumber({kSmallNumber}, kMinExponent, true);
+  const std::string kProductPath = path_ + ".product";
+
+  ASSERT_TRUE(IsOk(WriteProduct(kProductPath, MakeView(kHuge),
+                                MakeView(numbers_[2]))));
+  EXPECT_TRUE(IsInf(ToBigFloat(GetView(OpenColumn(kProductPath), 0))));
+
+  ASSERT_TRUE(IsOk(WriteProduct(kProductPath, MakeView(kTiny),
+                                MakeView(MakeNumber({kSmallNumber}, -1)))));
+  const BigFloat kZero = ToBigFloat(GetView(OpenColumn(kProductPath), 0));
+  EXPECT_TRUE(IsZero(kZero));
+  EXPECT_EQ(GetSign(kZero), GetNegative());
+  std::filesystem::remove(kProductPath);
+}
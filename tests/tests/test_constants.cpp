@@ -0,0 +1,154 @@
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Abs;
+using big_float::BigFloat;
+using big_float::ComputeE;
+using big_float::ComputeLn10;
+using big_float::ComputeLn2;
+using big_float::ComputePi;
+using big_float::Constant;
+using big_float::Exponent;
+using big_float::GetConstant;
+using big_float::GetDefaultError;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsLower;
+using big_float::MakeBigFloat;
+using big_float::Precision;
+using big_float::Sub;
+using big_float::Truncate;
+using big_float::Type;
+
+namespace {
+
+// pi = 3.243F6A8885A308D3... in hexadecimal, least significant limb first.
+const std::vector<uint64_t> kPiLimbs = {
+    0x3F84D5B5B5470917, 0xC0AC29B7C97C50DD, 0xBE5466CF34E90C6C,
+    0x452821E638D01377, 0x082EFA98EC4E6C89, 0xA4093822299F31D0,
+    0x13198A2E03707344, 0x243F6A8885A308D3, 0x0000000000000003};
+constexpr Exponent kPiExponent = -8;
+const std::vector<uint64_t> kELimbs = {
+    0xA784D9045190CFEF, 0x62E7160F38B4DA56, 0xBF7158809CF4F3C7,
+    0xB7E151628AED2A6A, 0x0000000000000002};
+const std::vector<uint64_t> kLn2Limbs = {
+    0x8A0D175B8BAAFA2B, 0x40F343267298B62D, 0xC9E3B39803F2F6AF,
+    0xB17217F7D1CF79AB};
+const std::vector<uint64_t> kLn10Limbs = {
+    0x0F187A0807C0B5CA, 0x8A3FB3E76977E43A, 0xA95B58AE0B4C28A3,
+    0x4D763776AAA2B05B, 0x0000000000000002};
+constexpr Exponent kShortExponent = -4;
+constexpr Precision kShortPrecision = 256;
+constexpr uint64_t kShortTolerance = 8;
+constexpr Precision kCachedPrecision = 1024;
+constexpr Precision kLowPrecision = 100;
+constexpr Precision kSharedPrecision = 2048;
+constexpr size_t kThreadCount = 4;
+constexpr Precision kPrecision = 448;
+constexpr Exponent kTolerance = -7;
+constexpr Precision kLongPrecision = 16384;
+constexpr Precision kLongerPrecision = 16448;
+constexpr Exponent kLongTolerance = -255;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+  return MakeBigFloat(mantissa, exp, GetPositive(), Type::kDefault,
+                      GetDefaultError());
+}
+
+}  // namespace
+
+class ConstantsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pi_ = MakeNumber(kPiLimbs, kPiExponent);
+    e_ = MakeNumber(kELimbs, kShortExponent);
+    ln2_ = MakeNumber(kLn2Limbs, kShortExponent);
+    ln10_ = MakeNumber(kLn10Limbs, kShortExponent);
+    short_tolerance_ = MakeNumber({kShortTolerance}, kShortExponent);
+  }
+
+  BigFloat pi_, e_, ln2_, ln10_;
+  BigFloat short_tolerance_;
+};
+
+TEST_F(ConstantsTest, PiMatchesReference) {
+  BigFloat result = ComputePi(kPrecision);
+
+  BigFloat error = Abs(Sub(result, pi_));
+
+  EXPECT_TRUE(IsLower(error, MakeNumber({2}, kTolerance)));
+}
+
+TEST_F(ConstantsTest, PiIsStableAcrossPrecisions) {
+  BigFloat result = ComputePi(kLongPrecision);
+  BigFloat refined = ComputePi(kLongerPrecision);
+
+  BigFloat error = Abs(Sub(result, refined));
+
+  EXPECT_TRUE(IsLower(error, MakeNumber({1}, kLongTolerance)));
+}
+
+TEST_F(ConstantsTest, EMatchesReference) {
+  BigFloat error = Abs(Sub(ComputeE(kShortPrecision), e_));
+
+  EXPECT_TRUE(IsLower(error, short_tolerance_));
+}
+
+TEST_F(ConstantsTest, Ln2MatchesReference) {
+  BigFloat error = Abs(Sub(ComputeLn2(kShortPrecision), ln2_));
+
+  EXPECT_TRUE(IsLower(error, short_tolerance_));
+}
+
+TEST_F(ConstantsTest, Ln10MatchesReference) {
+  BigFloat error = Abs(Sub(ComputeLn10(kShortPrecision), ln10_));
+
+  EXPECT_TRUE(IsLower(error, short_tolerance_));
+}
+
+TEST_F(ConstantsTest, CachedConstantMatchesReference) {
+  BigFloat error = Abs(Sub(GetConstant(Constant::kLn2, kShortPrecision), ln2_));
+
+  EXPECT_TRUE(IsLower(error, short_tolerance_));
+}
+
+TEST_F(ConstantsTest, LowerPrecisionTruncatesCachedValue) {
+  BigFloat precise = GetConstant(Constant::kPi, kCachedPrecision);
+
+  BigFloat result = GetConstant(Constant::kPi, kLowPrecision);
+
+  EXPECT_TRUE(IsEqual(result, Truncate(precise, kLowPrecision)));
+}
+
+TEST_F(ConstantsTest, ConcurrentRequestsAgree) {
+  std::vector<BigFloat> results(kThreadCount);
+  std::vector<std::thread> threads;
+  for (size_t index = 0; index < kThreadCount; ++index) {
+    threads.emplace_back([&results, index] {
+      results[index] = GetConstant(Constant::kE, kSharedPrecision);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (const BigFloat& result : results) {
+    EXPECT_TRUE(IsEqual(result, results.front()));
+  }
+}
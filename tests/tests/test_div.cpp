@@ -0,0 +1,152 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Abs;
+using big_float::BigFloat;
+using big_float::Div;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kDividend = 50;
+constexpr uint64_t kDivisor = 5;
+constexpr uint64_t kQuotient = 10;
+constexpr uint64_t kThree = 3;
+constexpr Exponent kExponent = 3;
+constexpr Precision kPrecision = 256;
+constexpr Exponent kTolerance = -3;
+constexpr size_t kLongLimbs = 160;
+constexpr Exponent kLongExponent = -160;
+constexpr Precision kLongPrecision = 160 * 64;
+constexpr Exponent kLongTolerance = -150;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+std::vector<uint64_t>
+MakeLimbs(size_t count) {
+  std::vector<uint64_t> limbs(count);
+  for (size_t index = 0; index < count; ++index) {
+    limbs[index] = (index + 1) * 0x9E3779B97F4A7C15;
+  }
+  return limbs;
+}
+
+}  // namespace
+
+class DivTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pos_zero_ = MakeZero(GetPositive());
+    neg_zero_ = MakeZero(GetNegative());
+    pos_inf_ = MakeInf(GetPositive());
+    neg_inf_ = MakeInf(GetNegative());
+    pos_nan_ = MakeNan(GetPositive());
+
+    dividend_ = MakeNumber({kDividend});
+    divisor_ = MakeNumber({kDivisor});
+    one_ = MakeNumber({1});
+    three_ = MakeNumber({kThree});
+  }
+
+  BigFloat pos_zero_, neg_zero_;
+  BigFloat pos_inf_, neg_inf_;
+  BigFloat pos_nan_;
+  BigFloat dividend_, divisor_;
+  BigFloat one_, three_;
+};
+
+TEST_F(DivTest, ExactQuotient) {
+  BigFloat result = Div(dividend_, divisor_);
+
+  EXPECT_TRUE(IsEqual(result, MakeNumber({kQuotient})));
+}
+
+TEST_F(DivTest, ExponentsSubtract) {
+  BigFloat dividend = MakeNumber({kDividend}, kExponent);
+  BigFloat divisor = MakeNumber({kDivisor}, 1);
+
+  BigFloat result = Div(dividend, divisor);
+
+  EXPECT_TRUE(IsEqual(result, MakeNumber({kQuotient}, kExponent - 1)));
+}
+
+TEST_F(DivTest, SignsCombine) {
+  BigFloat negative = MakeNumber({kDividend}, 0, true);
+
+  EXPECT_TRUE(IsEqual(Div(negative, divisor_),
+                      MakeNumber({kQuotient}, 0, true)));
+  EXPECT_TRUE(IsEqual(Div(negative, MakeNumber({kDivisor}, 0, true)),
+                      MakeNumber({kQuotient})));
+}
+
+TEST_F(DivTest, InexactQuotientMeetsPrecision) {
+  BigFloat third = Div(one_, three_, kPrecision);
+
+  BigFloat error = Abs(Sub(Mul(third, three_), one_));
+
+  EXPECT_TRUE(IsLower(error, MakeNumber({1}, kTolerance)));
+  EXPECT_TRUE(IsLower(Mul(third, three_), one_));
+}
+
+TEST_F(DivTest, LongDivisorUsesNewton) {
+  BigFloat divisor = MakeNumber(MakeLimbs(kLongLimbs), kLongExponent);
+  BigFloat dividend = MakeNumber({kThree});
+
+  BigFloat result = Div(dividend, divisor, kLongPrecision);
+  BigFloat error = Abs(Sub(Mul(result, divisor), dividend));
+
+  EXPECT_TRUE(IsLower(error, MakeNumber({1}, kLongTolerance)));
+}
+
+TEST_F(DivTest, ByZero) {
+  EXPECT_TRUE(IsInf(Div(dividend_, pos_zero_)));
+  EXPECT_TRUE(IsLower(Div(dividend_, neg_zero_), pos_zero_));
+  EXPECT_TRUE(IsNan(Div(pos_zero_, pos_zero_)));
+}
+
+TEST_F(DivTest, WithInfinity) {
+  EXPECT_TRUE(IsZero(Div(dividend_, pos_inf_)));
+  EXPECT_TRUE(IsInf(Div(neg_inf_, divisor_)));
+  EXPECT_TRUE(IsNan(Div(pos_inf_, neg_inf_)));
+}
+
+TEST_F(DivTest, NanPropagates) {
+  EXPECT_TRUE(IsNan(Div(pos_nan_, divisor_)));
+  EXPECT_TRUE(IsNan(Div(dividend_, pos_nan_)));
+}
@@ -0,0 +1,231 @@
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "elementary.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Abs;
+using big_float::BigFloat;
+using big_float::Div;
+using big_float::Exp;
+using big_float::Expm1;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsGreater;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsZero;
+using big_float::Log;
+using big_float::Log1p;
+using big_float::Log2;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeZero;
+using big_float::Neg;
+using big_float::Mul;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+// References with 256 fractional bits, least significant limb first.
+const std::vector<uint64_t> kExpHalfLimbs = {
+    0xC44BFC906367F2CC, 0xF651F16C130B4759, 0x2DFEFAB6DF33F9B1,
+    0xA61298E1E069BC97, 0x0000000000000001};
+const std::vector<uint64_t> kLn3Limbs = {
+    0x3D97EEEA5149358C, 0xBE1442D9B7E08DF0, 0xA4198D55053B7CB5,
+    0x193EA7AAD030A976, 0x0000000000000001};
+const std::vector<uint64_t> kLog2Of3Limbs = {
+    0x7BE5904D25FA41F7, 0x24F3E6A3A259B040, 0xA00B120A068BADD1,
+    0x95C01A39FBD6879F, 0x0000000000000001};
+constexpr Exponent kReferenceExponent = -4;
+constexpr uint64_t kReferenceTolerance = 8;
+constexpr Precision kPrecision = 256;
+constexpr Precision kSplittingPrecision = 6000;
+constexpr Exponent kSplittingTolerance = -90;
+constexpr Precision kAgmPrecision = 33000;
+constexpr Exponent kAgmTolerance = -510;
+constexpr uint64_t kHalf = uint64_t{1} << 63;
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kTen = 10;
+constexpr uint64_t kPowerOfTwo = 256;
+constexpr uint64_t kLog2OfPower = 8;
+constexpr uint64_t kLog2OfScaledPower = 56;
+constexpr uint64_t kTiny = 12345;
+constexpr Exponent kTinyExponent = -3;
+constexpr Exponent kRelativeTolerance = -3;
+constexpr Exponent kVanishingExponent = -(Exponent{1} << 21);
+constexpr Precision kShortPrecision = 64;
+constexpr auto kTinyArgumentTime = std::chrono::seconds(1);
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+bool
+IsClose(const BigFloat& value, const BigFloat& expected,
+        const BigFloat& tolerance) {
+  return IsLower(Abs(Sub(value, expected)), tolerance);
+}
+
+}  // namespace
+
+class ElementaryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pos_zero_ = MakeZero(GetPositive());
+    pos_inf_ = MakeInf(GetPositive());
+    neg_inf_ = MakeInf(GetNegative());
+    pos_nan_ = MakeNan(GetPositive());
+
+    one_ = MakeNumber({1});
+    half_ = MakeNumber({kHalf}, -1);
+    three_ = MakeNumber({kThree});
+    tolerance_ = MakeNumber({kReferenceTolerance}, kReferenceExponent);
+  }
+
+  BigFloat pos_zero_;
+  BigFloat pos_inf_, neg_inf_;
+  BigFloat pos_nan_;
+  BigFloat one_, half_, three_;
+  BigFloat tolerance_;
+};
+
+TEST_F(ElementaryTest, ExpMatchesReference) {
+  BigFloat result = Exp(half_, kPrecision);
+
+  EXPECT_TRUE(IsClose(result, MakeNumber(kExpHalfLimbs, kReferenceExponent),
+                      tolerance_));
+}
+
+TEST_F(ElementaryTest, ExpOfNegativeIsReciprocal) {
+  BigFloat ten = MakeNumber({kTen});
+
+  BigFloat product = Mul(Exp(ten, kPrecision), Exp(Sub(pos_zero_, ten),
+                                                   kPrecision));
+
+  EXPECT_TRUE(IsClose(product, one_, tolerance_));
+}
+
+TEST_F(ElementaryTest, LogMatchesReference) {
+  BigFloat result = Log(three_, kPrecision);
+
+  EXPECT_TRUE(
+      IsClose(result, MakeNumber(kLn3Limbs, kReferenceExponent), tolerance_));
+}
+
+TEST_F(ElementaryTest, LogOfOneIsZero) {
+  EXPECT_TRUE(IsZero(Log(one_, kPrecision)));
+}
+
+TEST_F(ElementaryTest, Log2OfPowerOfTwoIsExact) {
+  EXPECT_TRUE(IsEqual(Log2(MakeNumber({kPowerOfTwo}), kPrecision),
+                      MakeNumber({kLog2OfPower})));
+  EXPECT_TRUE(IsEqual(Log2(MakeNumber({kPowerOfTwo}, -1), kPrecision),
+                      MakeNumber({kLog2OfScaledPower}, 0, true)));
+}
+
+TEST_F(ElementaryTest, Log2MatchesReference) {
+  BigFloat result = Log2(three_, kPrecision);
+
+  EXPECT_TRUE(IsClose(result, MakeNumber(kLog2Of3Limbs, kReferenceExponent),
+                      tolerance_));
+}
+
+TEST_F(ElementaryTest, LogInvertsExpWithBinarySplitting) {
+  BigFloat result = Log(Exp(three_, kSplittingPrecision), kSplittingPrecision);
+
+  EXPECT_TRUE(IsClose(result, three_, MakeNumber({1}, kSplittingTolerance)));
+}
+
+TEST_F(ElementaryTest, LogUsesAgmAtVeryHighPrecision) {
+  BigFloat result = Log(three_, kAgmPrecision);
+  BigFloat tolerance = MakeNumber({1}, kAgmTolerance);
+
+  EXPECT_TRUE(IsClose(Exp(result, kAgmPrecision), three_, tolerance));
+}
+
+TEST_F(ElementaryTest, Expm1KeepsRelativePrecision) {
+  BigFloat tiny = MakeNumber({kTiny}, kTinyExponent);
+
+  BigFloat result = Expm1(tiny, kPrecision);
+  BigFloat relative = Div(Sub(result, tiny), tiny, kPrecision);
+
+  // expm1(x) = x + x^2 / 2 + ..., so (expm1(x) - x) / x ~ x / 2.
+  EXPECT_TRUE(IsClose(relative, Mul(tiny, half_),
+                      MakeNumber({1}, kTinyExponent * 2 + kRelativeTolerance)));
+}
+
+TEST_F(ElementaryTest, Log1pKeepsRelativePrecision) {
+  BigFloat tiny = MakeNumber({kTiny}, kTinyExponent);
+
+  BigFloat result = Log1p(tiny, kPrecision);
+  BigFloat relative = Div(Sub(tiny, result), tiny, kPrecision);
+
+  // log1p(x) = x - x^2 / 2 + ..., so (x - log1p(x)) / x ~ x / 2.
+  EXPECT_TRUE(IsClose(relative, Mul(tiny, half_),
+                      MakeNumber({1}, kTinyExponent * 2 + kRelativeTolerance)));
+}
+
+TEST_F(ElementaryTest, VanishingArgumentsTakeShortSeries) {
+  const auto kStart = std::chrono::steady_clock::now();
+  const BigFloat kTiny = MakeNumber({1}, kVanishingExponent);
+  const BigFloat kHalfTiny = MakeNumber({kHalf}, kVanishingExponent - 1);
+
+  const BigFloat kExpm1 = Expm1(kTiny, kShortPrecision);
+  const BigFloat kNegativeExpm1 = Expm1(Neg(kTiny), kShortPrecision);
+  const BigFloat kLog1p = Log1p(kTiny, kShortPrecision);
+
+  EXPECT_TRUE(IsEqual(kExpm1, kTiny));
+  EXPECT_TRUE(IsGreater(kNegativeExpm1, Neg(kTiny)));
+  EXPECT_TRUE(IsLower(kNegativeExpm1, Neg(kHalfTiny)));
+  EXPECT_TRUE(IsLower(kLog1p, kTiny));
+  EXPECT_TRUE(IsGreater(kLog1p, kHalfTiny));
+  EXPECT_LT(std::chrono::steady_clock::now() - kStart, kTinyArgumentTime);
+}
+
+TEST_F(ElementaryTest, SpecialValues) {
+  EXPECT_TRUE(IsEqual(Exp(pos_zero_, kPrecision), one_));
+  EXPECT_TRUE(IsInf(Exp(pos_inf_, kPrecision)));
+  EXPECT_TRUE(IsZero(Exp(neg_inf_, kPrecision)));
+  EXPECT_TRUE(IsNan(Exp(pos_nan_, kPrecision)));
+  EXPECT_TRUE(IsInf(Log(pos_zero_, kPrecision)));
+  EXPECT_TRUE(IsInf(Log(pos_inf_, kPrecision)));
+  EXPECT_TRUE(IsNan(Log(neg_inf_, kPrecision)));
+  EXPECT_TRUE(IsEqual(Expm1(neg_inf_, kPrecision), MakeNumber({1}, 0, true)));
+  EXPECT_TRUE(IsNan(Log1p(neg_inf_, kPrecision)));
+}
+
+TEST_F(ElementaryTest, DomainErrors) {
+  EXPECT_TRUE(IsNan(Log(MakeNumber({kThree}, 0, true), kPrecision)));
+  EXPECT_TRUE(IsInf(Log1p(MakeNumber({1}, 0, true), kPrecision)));
+  EXPECT_TRUE(IsNan(Log1p(MakeNumber({kThree}, 0, true), kPrecision)));
+}
+
+TEST_F(ElementaryTest, HugeExponentOverflows) {
+  EXPECT_TRUE(IsInf(Exp(MakeNumber({1}, 1), kPrecision)));
+  EXPECT_TRUE(IsZero(Exp(MakeNumber({1}, 1, true), kPrecision)));
+}
@@ -0,0 +1,122 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "constants.hpp"
+#include "executor.hpp"
+#include "precision.hpp"
+
+using big_float::BigFloat;
+using big_float::ComputePi;
+using big_float::Descend;
+using big_float::Executor;
+using big_float::ForkJoin;
+using big_float::GetExecutor;
+using big_float::IsEqual;
+using big_float::MakeParallelism;
+using big_float::MakeThreadPool;
+using big_float::Parallelism;
+using big_float::Precision;
+using big_float::SetExecutor;
+using big_float::Task;
+
+namespace {
+
+constexpr size_t kPoolThreads = 3;
+constexpr size_t kConcurrency = 4;
+constexpr int kDepth = 4;
+constexpr uint64_t kGrain = 4;
+constexpr uint64_t kCount = 1000;
+constexpr Precision kPrecision = 4096;
+
+// Sum of [begin, end) by recursive halving on `parallelism`.
+uint64_t
+SumRange(uint64_t begin, uint64_t end, const Parallelism& parallelism) {
+  if (end - begin <= 1) {
+    return begin;
+  }
+  const uint64_t kMiddle = begin + (end - begin) / 2;
+  const Parallelism kChild = Descend(parallelism);
+  uint64_t left = 0;
+  uint64_t right = 0;
+  ForkJoin(
+      parallelism, end - begin,
+      [&] { left = SumRange(begin, kMiddle, kChild); },
+      [&] { right = SumRange(kMiddle, end, kChild); });
+  return left + right;
+}
+
+}  // namespace
+
+class ExecutorTest : public ::testing::Test {
+ protected:
+  void SetUp() override { saved_ = GetExecutor(); }
+
+  void TearDown() override { SetExecutor(*saved_); }
+
+  std::shared_ptr<const Executor> saved_;
+};
+
+TEST_F(ExecutorTest, PoolRunsForkedWork) {
+  SetExecutor(MakeThreadPool(kPoolThreads));
+  const Parallelism kParallelism = MakeParallelism(kDepth, kGrain);
+
+  EXPECT_EQ(SumRange(0, kCount, kParallelism), kCount * (kCount - 1) / 2);
+}
+
+TEST_F(ExecutorTest, InjectedSchedulerReceivesTasks) {
+  auto submitted = std::make_shared<std::atomic<size_t>>(0);
+  SetExecutor({.submit =
+                   [submitted](Task task) {
+                     submitted->fetch_add(1);
+                     task();
+                   },
+               .concurrency = kConcurrency});
+  const Parallelism kParallelism = MakeParallelism(kGrain);
+
+  EXPECT_EQ(kParallelism.depth, 2);
+  EXPECT_EQ(SumRange(0, kCount, kParallelism), kCount * (kCount - 1) / 2);
+  EXPECT_EQ(submitted->load(), 3);
+}
+
+TEST_F(ExecutorTest, JoinDoesNotWaitForIdleScheduler) {
+  auto parked = std::make_shared<std::vector<Task>>();
+  SetExecutor({.submit = [parked](Task task) { parked->push_back(task); },
+               .concurrency = kConcurrency});
+
+  EXPECT_EQ(SumRange(0, kCount, MakeParallelism(kGrain)),
+            kCount * (kCount - 1) / 2);
+  for (const Task& task : *parked) {
+    task();
+  }
+}
+
+TEST_F(ExecutorTest, GrainAndDepthLimitForks) {
+  std::atomic<size_t> submitted = 0;
+  SetExecutor({.submit =
+                   [&submitted](Task task) {
+                     submitted.fetch_add(1);
+                     task();
+                   },
+               .concurrency = kConcurrency});
+
+  SumRange(0, kCount, MakeParallelism(0, kGrain));
+  SumRange(0, kCount, MakeParallelism(kDepth, kCount + 1));
+
+  EXPECT_EQ(submitted.load(), 0);
+}
+
+TEST_F(ExecutorTest, ParallelPiMatchesSequential) {
+  SetExecutor(MakeThreadPool(kPoolThreads));
+  const BigFloat kParallel =
+      ComputePi(kPrecision, MakeParallelism(kDepth, kGrain));
+  const BigFloat kSequential =
+      ComputePi(kPrecision, MakeParallelism(0, kGrain));
+
+  EXPECT_TRUE(IsEqual(kParallel, kSequential));
+}
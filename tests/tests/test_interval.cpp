@@ -0,0 +1,162 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "interval.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::BigInterval;
+using big_float::Constant;
+using big_float::Contains;
+using big_float::Div;
+using big_float::Exponent;
+using big_float::GetConstant;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::GetWidth;
+using big_float::IsCertainlyGreater;
+using big_float::IsCertainlyLower;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsPoint;
+using big_float::IsPossiblyEqual;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInterval;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sqrt;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kTwo = 2;
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kSix = 6;
+constexpr uint64_t kOddTop = 0x8000000000000001;
+constexpr Precision kPrecision = 64;
+constexpr Precision kHighPrecision = 512;
+constexpr Exponent kWidthTolerance = -1;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+}  // namespace
+
+class IntervalTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    one_ = MakeInterval(MakeNumber({1}));
+    two_ = MakeInterval(MakeNumber({kTwo}));
+    three_ = MakeInterval(MakeNumber({kThree}));
+    minus_three_ = MakeInterval(MakeNumber({kThree}, 0, true));
+    around_zero_ =
+        MakeInterval(MakeNumber({1}, 0, true), MakeNumber({kTwo}));
+    width_tolerance_ = MakeNumber({1}, kWidthTolerance);
+  }
+
+  BigInterval one_, two_, three_, minus_three_, around_zero_;
+  BigFloat width_tolerance_;
+};
+
+TEST_F(IntervalTest, ExactOperationsStayPoints) {
+  BigInterval sum = Add(one_, two_, kPrecision);
+  BigInterval product = Mul(two_, minus_three_, kPrecision);
+
+  EXPECT_TRUE(IsPoint(sum));
+  EXPECT_TRUE(IsEqual(sum.lower, three_.lower));
+  EXPECT_TRUE(IsPoint(product));
+  EXPECT_TRUE(IsEqual(product.upper, MakeNumber({kSix}, 0, true)));
+}
+
+TEST_F(IntervalTest, InexactSumIsRoundedOutward) {
+  // 2^64 + 1 needs 65 bits.
+  BigInterval wide = MakeInterval(MakeNumber({1, 1}));
+
+  BigInterval result = Add(wide, MakeInterval(MakeZero()), kPrecision);
+  BigInterval negated = Sub(MakeInterval(MakeZero()), wide, kPrecision);
+
+  EXPECT_TRUE(IsLower(result.lower, wide.lower));
+  EXPECT_TRUE(IsLower(wide.upper, result.upper));
+  EXPECT_TRUE(Contains(negated, MakeNumber({1, 1}, 0, true)));
+  EXPECT_FALSE(IsPoint(negated));
+}
+
+TEST_F(IntervalTest, MulPicksExtremeProducts) {
+  BigInterval result = Mul(around_zero_, minus_three_, kPrecision);
+
+  EXPECT_TRUE(IsEqual(result.lower, MakeNumber({kSix}, 0, true)));
+  EXPECT_TRUE(IsEqual(result.upper, three_.lower));
+}
+
+TEST_F(IntervalTest, DivEnclosesQuotient) {
+  BigInterval third = Div(one_, three_, kPrecision);
+  BigInterval product = Mul(third, three_, kPrecision);
+
+  EXPECT_TRUE(Contains(product, one_.lower));
+  EXPECT_TRUE(IsLower(GetWidth(third), width_tolerance_));
+  EXPECT_FALSE(IsPoint(third));
+}
+
+TEST_F(IntervalTest, DivByIntervalWithZeroIsEntire) {
+  BigInterval result = Div(one_, around_zero_, kPrecision);
+
+  EXPECT_TRUE(IsInf(result.lower));
+  EXPECT_TRUE(IsInf(result.upper));
+}
+
+TEST_F(IntervalTest, SqrtEnclosesRoot) {
+  BigInterval root = Sqrt(two_, kPrecision);
+  BigFloat reference = Sqrt(two_.lower, kHighPrecision);
+
+  EXPECT_TRUE(Contains(root, reference));
+  EXPECT_TRUE(Contains(Mul(root, root, kPrecision), two_.lower));
+  EXPECT_TRUE(IsZero(Sqrt(around_zero_, kPrecision).lower));
+  EXPECT_TRUE(IsNan(Sqrt(minus_three_, kPrecision).lower));
+}
+
+TEST_F(IntervalTest, ChainedOperationsEnclosePi) {
+  BigFloat pi = GetConstant(Constant::kPi, kHighPrecision);
+  BigInterval bounded = MakeInterval(GetConstant(Constant::kPi, kPrecision),
+                                     Add(pi, MakeNumber({1}, -1)));
+  BigInterval odd = MakeInterval(MakeNumber({kOddTop}, -1));
+
+  BigInterval result =
+      Sub(Mul(Div(bounded, odd, kPrecision), odd, kPrecision), one_,
+          kPrecision);
+
+  EXPECT_TRUE(Contains(result, Sub(pi, one_.lower)));
+}
+
+TEST_F(IntervalTest, Comparisons) {
+  EXPECT_TRUE(IsCertainlyLower(one_, two_));
+  EXPECT_TRUE(IsCertainlyGreater(three_, around_zero_));
+  EXPECT_FALSE(IsCertainlyLower(around_zero_, two_));
+  EXPECT_TRUE(IsPossiblyEqual(around_zero_, one_));
+  EXPECT_FALSE(IsPossiblyEqual(minus_three_, around_zero_));
+  EXPECT_TRUE(Contains(around_zero_, MakeZero()));
+}
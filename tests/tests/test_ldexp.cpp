@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::BigFloat;
+using big_float::Decomposition;
+using big_float::Exponent;
+using big_float::Frexp;
+using big_float::GetSign;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::Ilogb;
+using big_float::IsEqual;
+using big_float::IsGreater;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsZero;
+using big_float::kIlogbInf;
+using big_float::kIlogbNan;
+using big_float::kIlogbZero;
+using big_float::Ldexp;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::Sign;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kSix = 6;
+constexpr uint64_t kThreeQuarters = uint64_t{3} << 62;
+constexpr uint64_t kHighBit = uint64_t{1} << 63;
+constexpr int64_t kLimbBits = 64;
+constexpr int64_t kOddShift = 67;
+constexpr int64_t kHugeShift = int64_t{1} << 62;
+constexpr int64_t kMaxShift = std::numeric_limits<int64_t>::max();
+constexpr int64_t kMinShift = std::numeric_limits<int64_t>::min();
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+}  // namespace
+
+class LdexpTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    three_ = MakeNumber({kThree});
+    minus_three_ = MakeNumber({kThree}, 0, true);
+  }
+
+  BigFloat three_, minus_three_;
+};
+
+TEST_F(LdexpTest, ShiftsByBits) {
+  EXPECT_TRUE(IsEqual(Ldexp(three_, 1), MakeNumber({kSix})));
+  EXPECT_TRUE(IsEqual(Ldexp(three_, -2), MakeNumber({kThreeQuarters}, -1)));
+  EXPECT_TRUE(IsEqual(Ldexp(minus_three_, kOddShift),
+                      MakeNumber({kThree << 3}, 1, true)));
+}
+
+TEST_F(LdexpTest, WholeLimbShiftKeepsMantissa) {
+  BigFloat number = MakeNumber({1, kThree});
+  const uint64_t* limbs = number.number.limbs.data();
+
+  BigFloat result = Ldexp(std::move(number), -2 * kLimbBits);
+
+  EXPECT_EQ(result.number.limbs.data(), limbs);
+  EXPECT_TRUE(IsEqual(result, MakeNumber({1, kThree}, -2)));
+}
+
+TEST_F(LdexpTest, SpecialValuesUnchanged) {
+  EXPECT_TRUE(IsInf(Ldexp(MakeInf(), kOddShift)));
+  EXPECT_TRUE(IsEqual(Ldexp(MakeZero(), kOddShift), MakeZero()));
+}
+
+TEST_F(LdexpTest, FrexpSplitsNumber) {
+  Decomposition result = Frexp(minus_three_);
+
+  EXPECT_EQ(result.exponent, 2);
+  EXPECT_TRUE(
+      IsEqual(result.fraction, MakeNumber({kThreeQuarters}, -1, true)));
+  EXPECT_TRUE(IsEqual(Ldexp(result.fraction, result.exponent), minus_three_));
+}
+
+TEST_F(LdexpTest, IlogbIsExact) {
+  EXPECT_EQ(Ilogb(three_), 1);
+  EXPECT_EQ(Ilogb(MakeNumber({kHighBit}, -1)), -1);
+  EXPECT_EQ(Ilogb(MakeNumber({0, 1}, -3)), -kLimbBits * 2);
+  EXPECT_EQ(Ilogb(MakeZero()), kIlogbZero);
+  EXPECT_EQ(Ilogb(MakeInf(GetNegative())), kIlogbInf);
+  EXPECT_EQ(Ilogb(MakeNan()), kIlogbNan);
+}
+
+TEST_F(LdexpTest, CompareUsesBitLength) {
+  BigFloat large = MakeNumber({kHighBit});
+  BigFloat small = MakeNumber({kThree});
+
+  EXPECT_TRUE(IsGreater(large, small));
+  EXPECT_TRUE(IsLower(Mul(small, minus_three_), minus_three_));
+  EXPECT_TRUE(IsLower(Ldexp(large, -kLimbBits), MakeNumber({1})));
+}
+
+TEST_F(LdexpTest, SaturatesOutsideExponentRange) {
+  const BigFloat kOne = MakeNumber({1});
+  const BigFloat kMinusThree = MakeNumber({kThree}, 0, true);
+
+  EXPECT_TRUE(IsEqual(Ldexp(kOne, kHugeShift), MakeInf()));
+  EXPECT_TRUE(IsEqual(Ldexp(kMinusThree, kMaxShift), MakeInf(GetNegative())));
+  EXPECT_TRUE(IsZero(Ldexp(kOne, -kHugeShift)));
+
+  const BigFloat kZero = Ldexp(kMinusThree, kMinShift);
+  EXPECT_TRUE(IsZero(kZero));
+  EXPECT_EQ(GetSign(kZero), GetNegative());
+}
@@ -1,4 +1,7 @@
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -16,12 +19,16 @@ using big_float::GetNegative;
 using big_float::GetPositive;
 using big_float::IsEqual;
 using big_float::IsNan;
+using big_float::kMaxExponent;
+using big_float::kMinExponent;
 using big_float::MakeBigFloat;
 using big_float::MakeInf;
 using big_float::MakeNan;
 using big_float::MakeZero;
 using big_float::Mul;
+using big_float::Neg;
 using big_float::Sign;
+using big_float::Sqr;
 using big_float::Type;
 
 namespace {
@@ -33,6 +40,12 @@ constexpr uint64_t kTestNumber = 3;
 constexpr uint64_t kOne = 1;
 constexpr Exponent kSmallExponent = 2;
 constexpr Exponent kLargeExponent = 4;
+constexpr uint64_t kSmallSquare = 25;
+constexpr uint64_t kAllOnes = std::numeric_limits<uint64_t>::max();
+constexpr uint64_t kLcgMultiplier = 6364136223846793005;
+constexpr uint64_t kLcgIncrement = 1442695040888963407;
+constexpr size_t kSchoolbookLimbs = 7;
+constexpr size_t kKaratsubaLimbs = 97;
 
 BigFloat
 MakeNumber(uint64_t value, Exponent exp = 0, bool negative = false) {
@@ -43,6 +56,20 @@ MakeNumber(uint64_t value, Exponent exp = 0, bool negative = false) {
   return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
 }
 
+// Limbs from a linear congruential generator, every third one all ones so
+// that the doubled cross products carry.
+BigFloat
+MakeLongNumber(size_t size, Exponent exp = 0) {
+  big_uint::BigUInt mantissa;
+  uint64_t state = kOne;
+  for (size_t index = 0; index < size; ++index) {
+    state = state * kLcgMultiplier + kLcgIncrement;
+    mantissa.limbs.push_back(index % 3 == 0 ? kAllOnes : state);
+  }
+  return MakeBigFloat(mantissa, exp, GetPositive(), Type::kDefault,
+                      GetDefaultError());
+}
+
 }  // namespace
 
 class MulTest : public ::testing::Test {
@@ -313,3 +340,39 @@ TEST_F(MulTest, CommutativeWithInfinity) {
 
   EXPECT_TRUE(IsEqual(result1, result2));
 }
+
+TEST_F(MulTest, SquareMatchesProduct) {
+  for (const size_t kSize : {kSchoolbookLimbs, kKaratsubaLimbs}) {
+    const BigFloat kNumber = MakeLongNumber(kSize, -kSmallExponent);
+    const BigFloat kCopy = kNumber;
+
+    EXPECT_TRUE(IsEqual(Sqr(kNumber), Mul(kNumber, kCopy)));
+  }
+}
+
+TEST_F(MulTest, AliasedArgumentsAreSquared) {
+  EXPECT_TRUE(IsEqual(Mul(small_neg_, small_neg_), MakeNumber(kSmallSquare)));
+  EXPECT_TRUE(IsEqual(Sqr(small_neg_), MakeNumber(kSmallSquare)));
+  EXPECT_TRUE(IsEqual(Sqr(small_exp_neg_),
+                      MakeNumber(kTestNumber * kTestNumber,
+                                 2 * kSmallExponent)));
+}
+
+TEST_F(MulTest, SquareOfSpecialValues) {
+  EXPECT_TRUE(IsEqual(Sqr(neg_zero_), pos_zero_));
+  EXPECT_TRUE(IsEqual(Sqr(neg_inf_), pos_inf_));
+  EXPECT_TRUE(IsNan(Sqr(neg_nan_)));
+  EXPECT_TRUE(IsEqual(Sqr(Neg(one_pos_)), one_pos_));
+}
+
+TEST_F(MulTest, ExponentOutsideRangeSaturates) {
+  const BigFloat kHuge = MakeNumber(kTestNumber, kMaxExponent);
+  const BigFloat kTiny = MakeNumber(kTestNumber, kMinExponent);
+
+  EXPECT_TRUE(IsEqual(Mul(kHuge, MakeNumber(kTestNumber, 1, true)),
+                      neg_inf_));
+  EXPECT_TRUE(IsEqual(Sqr(kHuge), pos_inf_));
+  EXPECT_TRUE(IsEqual(Mul(kTiny, MakeNumber(kTestNumber, -1)), pos_zero_));
+  EXPECT_TRUE(IsEqual(MakeNumber(kOne, kMaxExponent + 1), pos_inf_));
+  EXPECT_TRUE(IsEqual(MakeNumber(kOne, kMinExponent - 1, true), neg_zero_));
+}
@@ -0,0 +1,220 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "elementary.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Abs;
+using big_float::BigFloat;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::GetSign;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsNegative;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::NthRoot;
+using big_float::Pow;
+using big_float::PowInt;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kTwo = 2;
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kEight = 8;
+constexpr uint64_t kCube = 27;
+constexpr uint64_t kFifthPower = 32;
+constexpr uint64_t kThreeToFifth = 243;
+constexpr uint64_t kEighth = uint64_t{1} << 61;
+constexpr uint64_t kHalf = uint64_t{1} << 63;
+constexpr uint64_t kQuarter = uint64_t{1} << 62;
+constexpr uint64_t kSixteen = 16;
+constexpr uint64_t kFifthDegree = 5;
+constexpr uint64_t kLargeDegree = 1000;
+constexpr int64_t kLargePower = 1000;
+constexpr uint64_t kHugePowerLimb = 64;
+constexpr uint64_t kMaxDegree = ~uint64_t{0};
+constexpr uint64_t kTopBitDegree = uint64_t{1} << 63;
+constexpr Precision kShortPrecision = 64;
+constexpr uint64_t kRootTolerance = 16;
+constexpr Precision kPrecision = 256;
+constexpr Precision kHighPrecision = 3000;
+constexpr Exponent kTolerance = -3;
+constexpr Exponent kRelativeTolerance = -46;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+bool
+IsClose(const BigFloat& value, const BigFloat& expected,
+        const BigFloat& tolerance) {
+  return IsLower(Abs(Sub(value, expected)), tolerance);
+}
+
+}  // namespace
+
+class PowTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pos_zero_ = MakeZero(GetPositive());
+    neg_zero_ = MakeZero(GetNegative());
+    pos_inf_ = MakeInf(GetPositive());
+    neg_inf_ = MakeInf(GetNegative());
+    pos_nan_ = MakeNan(GetPositive());
+
+    one_ = MakeNumber({1});
+    two_ = MakeNumber({kTwo});
+    three_ = MakeNumber({kThree});
+    half_ = MakeNumber({kHalf}, -1);
+    tolerance_ = MakeNumber({1}, kTolerance);
+  }
+
+  BigFloat pos_zero_, neg_zero_;
+  BigFloat pos_inf_, neg_inf_;
+  BigFloat pos_nan_;
+  BigFloat one_, two_, three_, half_;
+  BigFloat tolerance_;
+};
+
+TEST_F(PowTest, PowIntIsExactForSmallPowers) {
+  EXPECT_TRUE(
+      IsEqual(PowInt(three_, 5, kPrecision), MakeNumber({kThreeToFifth})));
+  EXPECT_TRUE(IsEqual(PowInt(two_, -3, kPrecision), MakeNumber({kEighth}, -1)));
+}
+
+TEST_F(PowTest, PowIntSignFollowsParity) {
+  BigFloat negative = MakeNumber({kThree}, 0, true);
+
+  EXPECT_TRUE(IsNegative(GetSign(PowInt(negative, 3, kPrecision))));
+  EXPECT_FALSE(IsNegative(GetSign(PowInt(negative, 4, kPrecision))));
+}
+
+TEST_F(PowTest, PowIntLargePowerKeepsPrecision) {
+  BigFloat result = PowInt(three_, kLargePower, kHighPrecision);
+  BigFloat inverse = PowInt(three_, -kLargePower, kHighPrecision);
+
+  EXPECT_TRUE(IsClose(Mul(result, inverse), one_,
+                      MakeNumber({1}, kRelativeTolerance)));
+}
+
+TEST_F(PowTest, PowIntSpecialValues) {
+  EXPECT_TRUE(IsEqual(PowInt(pos_nan_, 0, kPrecision), one_));
+  EXPECT_TRUE(IsInf(PowInt(pos_zero_, -1, kPrecision)));
+  EXPECT_TRUE(IsNegative(GetSign(PowInt(neg_zero_, -3, kPrecision))));
+  EXPECT_TRUE(IsZero(PowInt(neg_inf_, -2, kPrecision)));
+  EXPECT_TRUE(IsNan(PowInt(pos_nan_, 2, kPrecision)));
+}
+
+TEST_F(PowTest, NthRootOfPerfectPowers) {
+  BigFloat cube_root = NthRoot(MakeNumber({kCube}), 3, kPrecision);
+  BigFloat fifth_root =
+      NthRoot(MakeNumber({kFifthPower}, 0, true), kFifthDegree, kPrecision);
+
+  EXPECT_TRUE(IsClose(cube_root, three_, tolerance_));
+  EXPECT_TRUE(IsClose(fifth_root, MakeNumber({kTwo}, 0, true), tolerance_));
+}
+
+TEST_F(PowTest, NthRootLargeDegree) {
+  BigFloat root = NthRoot(three_, kLargeDegree, kHighPrecision);
+
+  BigFloat result = PowInt(root, kLargePower, kHighPrecision);
+
+  EXPECT_TRUE(IsClose(result, three_, MakeNumber({1}, kRelativeTolerance)));
+}
+
+TEST_F(PowTest, NthRootDomain) {
+  EXPECT_TRUE(IsNan(NthRoot(MakeNumber({kTwo}, 0, true), 4, kPrecision)));
+  EXPECT_TRUE(IsNan(NthRoot(two_, 0, kPrecision)));
+  EXPECT_TRUE(IsNan(NthRoot(neg_inf_, 2, kPrecision)));
+  EXPECT_TRUE(IsEqual(NthRoot(neg_inf_, 3, kPrecision), neg_inf_));
+  EXPECT_TRUE(IsZero(NthRoot(pos_zero_, 3, kPrecision)));
+}
+
+TEST_F(PowTest, PowWithFractionalExponent) {
+  BigFloat quarter = MakeNumber({kQuarter}, -1);
+
+  EXPECT_TRUE(IsClose(Pow(MakeNumber({kSixteen}), quarter, kPrecision), two_,
+                      tolerance_));
+  EXPECT_TRUE(IsClose(Pow(MakeNumber({kTwo + kTwo}), half_, kPrecision), two_,
+                      tolerance_));
+}
+
+TEST_F(PowTest, PowWithIntegerExponentIsExact) {
+  EXPECT_TRUE(IsEqual(Pow(two_, three_, kPrecision), MakeNumber({kEight})));
+  EXPECT_TRUE(IsEqual(Pow(MakeNumber({kTwo}, 0, true), three_, kPrecision),
+                      MakeNumber({kEight}, 0, true)));
+}
+
+TEST_F(PowTest, PowSpecialValues) {
+  EXPECT_TRUE(IsEqual(Pow(pos_nan_, pos_zero_, kPrecision), one_));
+  EXPECT_TRUE(IsEqual(Pow(one_, pos_nan_, kPrecision), one_));
+  EXPECT_TRUE(IsNan(Pow(MakeNumber({kTwo}, 0, true), half_, kPrecision)));
+  EXPECT_TRUE(IsZero(Pow(half_, pos_inf_, kPrecision)));
+  EXPECT_TRUE(IsInf(Pow(half_, neg_inf_, kPrecision)));
+  EXPECT_TRUE(IsEqual(Pow(MakeNumber({1}, 0, true), pos_inf_, kPrecision),
+                      one_));
+  EXPECT_TRUE(IsInf(Pow(pos_zero_, Sub(pos_zero_, half_), kPrecision)));
+  EXPECT_TRUE(IsZero(Pow(pos_inf_, Sub(pos_zero_, half_), kPrecision)));
+}
+
+TEST_F(PowTest, PowNegativeBaseWithHugeIntegerExponent) {
+  const BigFloat kEven = MakeNumber({kHugePowerLimb}, 1);
+  const BigFloat kOdd = MakeNumber({0, 1, kHugePowerLimb}, -1);
+  const BigFloat kMinusOne = MakeNumber({1}, 0, true);
+  const BigFloat kMinusTwo = MakeNumber({kTwo}, 0, true);
+  const BigFloat kMinusHalf = MakeNumber({kHalf}, -1, true);
+
+  EXPECT_TRUE(IsEqual(Pow(kMinusOne, kEven, kPrecision), one_));
+  EXPECT_TRUE(IsEqual(Pow(kMinusOne, kOdd, kPrecision), kMinusOne));
+  EXPECT_TRUE(IsEqual(Pow(kMinusTwo, kEven, kPrecision), pos_inf_));
+  EXPECT_TRUE(IsEqual(Pow(kMinusTwo, kOdd, kPrecision), neg_inf_));
+  EXPECT_TRUE(IsZero(Pow(kMinusHalf, kEven, kPrecision)));
+  EXPECT_FALSE(IsNegative(GetSign(Pow(kMinusHalf, kEven, kPrecision))));
+  EXPECT_TRUE(IsNegative(GetSign(Pow(neg_zero_, kOdd, kPrecision))));
+}
+
+TEST_F(PowTest, NthRootDegreesBeyondInt64) {
+  const BigFloat kTolerance = MakeNumber({kRootTolerance}, -1);
+  const BigFloat kMinusOne = MakeNumber({1}, 0, true);
+
+  for (const uint64_t kDegree : {kTopBitDegree - 1, kTopBitDegree,
+                                 kMaxDegree}) {
+    const BigFloat kRoot = NthRoot(three_, kDegree, kShortPrecision);
+    EXPECT_TRUE(IsClose(kRoot, one_, kTolerance));
+    EXPECT_FALSE(IsLower(kRoot, one_));
+  }
+  EXPECT_TRUE(IsClose(NthRoot(MakeNumber({kThree}, 0, true), kMaxDegree,
+                              kShortPrecision),
+                      kMinusOne, kTolerance));
+  EXPECT_TRUE(IsNan(
+      NthRoot(MakeNumber({kThree}, 0, true), kTopBitDegree, kShortPrecision)));
+}
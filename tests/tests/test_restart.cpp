@@ -0,0 +1,155 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "async.hpp"
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "restart.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::BigFloat;
+using big_float::Cancel;
+using big_float::ComputePi;
+using big_float::Div;
+using big_float::ErrorCode;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetError;
+using big_float::GetErrorCode;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsNan;
+using big_float::MakeBigFloat;
+using big_float::MakeCancelToken;
+using big_float::Precision;
+using big_float::RestartOptions;
+using big_float::ResumeDiv;
+using big_float::ResumePi;
+using big_float::Sign;
+using big_float::Type;
+
+namespace {
+
+constexpr size_t kDivisorLimbs = 128;
+constexpr uint64_t kLimbPattern = 0x9E3779B97F4A7C15;
+constexpr Precision kPiPrecision = 65536;
+constexpr Precision kDivPrecision = 65536;
+constexpr size_t kGarbageBytes = 256;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+std::string
+MakeTempPath() {
+  const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+  const std::string kName =
+      std::string("big_float_") + info->name() + ".restart";
+  return (std::filesystem::temp_directory_path() / kName).string();
+}
+
+ErrorCode
+GetCode(const BigFloat& number) {
+  return GetErrorCode(GetError(number));
+}
+
+}  // namespace
+
+class RestartTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dividend_ = MakeNumber({kLimbPattern, 1}, 0, true);
+    divisor_ = MakeNumber(std::vector<uint64_t>(kDivisorLimbs, kLimbPattern),
+                          -static_cast<Exponent>(kDivisorLimbs));
+    options_ = {.path = MakeTempPath(),
+                .interval = std::chrono::steady_clock::duration::zero(),
+                .token = {}};
+    preempted_ = options_;
+    preempted_.token = MakeCancelToken();
+    Cancel(preempted_.token);
+  }
+
+  void TearDown() override { std::filesystem::remove(options_.path); }
+
+  BigFloat dividend_, divisor_;
+  RestartOptions options_, preempted_;
+};
+
+TEST_F(RestartTest, PiRunsThrough) {
+  const BigFloat kPi = ComputePi(kPiPrecision, options_);
+
+  EXPECT_TRUE(IsEqual(kPi, ComputePi(kPiPrecision)));
+  EXPECT_FALSE(std::filesystem::exists(options_.path));
+}
+
+TEST_F(RestartTest, PiResumesAfterPreemption) {
+  const BigFloat kStopped = ComputePi(kPiPrecision, preempted_);
+
+  EXPECT_TRUE(IsNan(kStopped));
+  EXPECT_EQ(GetCode(kStopped), ErrorCode::kCancelled);
+  ASSERT_TRUE(std::filesystem::exists(options_.path));
+
+  EXPECT_EQ(GetCode(ResumePi(preempted_)), ErrorCode::kCancelled);
+  const BigFloat kPi = ResumePi(options_);
+
+  EXPECT_TRUE(IsEqual(kPi, ComputePi(kPiPrecision)));
+  EXPECT_FALSE(std::filesystem::exists(options_.path));
+}
+
+TEST_F(RestartTest, DivResumesAfterPreemption) {
+  const BigFloat kStopped =
+      Div(dividend_, divisor_, kDivPrecision, preempted_);
+
+  EXPECT_EQ(GetCode(kStopped), ErrorCode::kCancelled);
+  ASSERT_TRUE(std::filesystem::exists(options_.path));
+
+  const BigFloat kQuotient = ResumeDiv(dividend_, divisor_, options_);
+
+  EXPECT_TRUE(IsEqual(kQuotient, Div(dividend_, divisor_, kDivPrecision)));
+  EXPECT_FALSE(std::filesystem::exists(options_.path));
+}
+
+TEST_F(RestartTest, RejectsOtherDivisor) {
+  Div(dividend_, divisor_, kDivPrecision, preempted_);
+  const BigFloat kOther = MakeNumber(
+      std::vector<uint64_t>(kDivisorLimbs, kLimbPattern + 1));
+
+  EXPECT_EQ(GetCode(ResumeDiv(dividend_, kOther, options_)),
+            ErrorCode::kInvalidFormat);
+  EXPECT_EQ(GetCode(ResumePi(options_)), ErrorCode::kInvalidFormat);
+}
+
+TEST_F(RestartTest, ReportsBrokenCheckpoints) {
+  EXPECT_EQ(GetCode(ResumePi(options_)), ErrorCode::kIoError);
+
+  ComputePi(kPiPrecision, preempted_);
+  std::filesystem::resize_file(options_.path,
+                               std::filesystem::file_size(options_.path) / 2);
+
+  EXPECT_TRUE(IsNan(ResumePi(options_)));
+
+  std::ofstream(options_.path, std::ios::binary | std::ios::trunc)
+      << std::string(kGarbageBytes, 'x');
+
+  EXPECT_EQ(GetCode(ResumePi(options_)), ErrorCode::kInvalidFormat);
+}
@@ -0,0 +1,150 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "rounding.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Constant;
+using big_float::ErrorCode;
+using big_float::EvaluateRounded;
+using big_float::Exp;
+using big_float::Exponent;
+using big_float::GetConstant;
+using big_float::GetDefaultError;
+using big_float::GetError;
+using big_float::GetErrorCode;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsNan;
+using big_float::IsOk;
+using big_float::IsRoundable;
+using big_float::kZivGuardBits;
+using big_float::kZivMaxAttempts;
+using big_float::MakeBigFloat;
+using big_float::MakeNan;
+using big_float::Precision;
+using big_float::Truncate;
+using big_float::Type;
+using big_float::ZivApproximation;
+
+namespace {
+
+constexpr uint64_t kNearBoundary = uint64_t{1} << 28;
+constexpr Precision kPrecision = 64;
+constexpr Precision kHighPrecision = 1024;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  return MakeBigFloat(mantissa, exp, GetPositive(), Type::kDefault,
+                      GetDefaultError());
+}
+
+}  // namespace
+
+class RoundingTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    one_ = MakeNumber({1});
+    // 1 + 2^-100: truncates to 1 at 64 bits, but a 96-bit
+    // approximation cannot tell it from a value just below 1.
+    near_one_ = MakeNumber({kNearBoundary, 0, 1}, -2);
+  }
+
+  BigFloat one_, near_one_;
+};
+
+TEST_F(RoundingTest, FirstAttemptSucceedsAwayFromBoundary) {
+  int calls = 0;
+  const auto kFunction = [&](Precision working) {
+    ++calls;
+    return GetConstant(Constant::kPi, working);
+  };
+
+  BigFloat result = EvaluateRounded(kFunction, kPrecision);
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_TRUE(
+      IsEqual(result, Truncate(GetConstant(Constant::kPi, kHighPrecision),
+                               kPrecision)));
+}
+
+TEST_F(RoundingTest, RetriesNearBoundary) {
+  int calls = 0;
+  const auto kFunction = [&](Precision working) {
+    ++calls;
+    return Truncate(near_one_, working);
+  };
+
+  BigFloat result = EvaluateRounded(kFunction, kPrecision);
+
+  EXPECT_EQ(calls, 2);
+  EXPECT_TRUE(IsEqual(result, one_));
+}
+
+TEST_F(RoundingTest, ReportedExactResultStopsAtOnce) {
+  int calls = 0;
+  const auto kFunction = [&](Precision) {
+    ++calls;
+    return ZivApproximation{.value = one_, .is_exact = true};
+  };
+
+  BigFloat result = EvaluateRounded(kFunction, kPrecision);
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_TRUE(IsEqual(result, one_));
+  EXPECT_TRUE(IsOk(GetError(result)));
+}
+
+TEST_F(RoundingTest, UnprovenResultIsFlagged) {
+  int calls = 0;
+  const auto kFunction = [&](Precision) {
+    ++calls;
+    return one_;
+  };
+
+  BigFloat result = EvaluateRounded(kFunction, kPrecision);
+
+  EXPECT_EQ(calls, kZivMaxAttempts);
+  EXPECT_TRUE(IsEqual(result, one_));
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kRoundingUnproven);
+}
+
+TEST_F(RoundingTest, MatchesHighPrecisionReference) {
+  const BigFloat kOperand = MakeNumber({uint64_t{3} << 62}, -1);
+  const auto kFunction = [&](Precision working) {
+    return Add(Exp(kOperand, working), one_);
+  };
+
+  BigFloat result = EvaluateRounded(kFunction, kPrecision);
+  BigFloat reference =
+      Truncate(Add(Exp(kOperand, kHighPrecision), one_), kPrecision);
+
+  EXPECT_TRUE(IsEqual(result, reference));
+}
+
+TEST_F(RoundingTest, IsRoundable) {
+  const Precision kWorking = kPrecision + kZivGuardBits;
+
+  EXPECT_FALSE(IsRoundable(one_, kWorking, kPrecision));
+  EXPECT_TRUE(IsRoundable(Truncate(near_one_, 2 * kWorking), 2 * kWorking,
+                          kPrecision));
+  EXPECT_TRUE(IsRoundable(MakeNan(), kWorking, kPrecision));
+  EXPECT_TRUE(IsNan(EvaluateRounded([](Precision) { return MakeNan(); },
+                                    kPrecision)));
+}
@@ -0,0 +1,131 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Div;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::GetSign;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsNan;
+using big_float::IsNegative;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::Mul;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kOne = 1;
+constexpr uint64_t kTwo = 2;
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kFive = 5;
+constexpr uint64_t kSeven = 7;
+constexpr uint64_t kTen = 10;
+constexpr uint64_t kHalf = uint64_t{1} << 63;
+constexpr uint64_t kLarge = 0xFEDCBA9876543210;
+constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+constexpr int64_t kMinusThree = -3;
+constexpr int64_t kMinusTwo = -2;
+constexpr double kOneAndHalf = 1.5;
+constexpr double kQuarter = 0.25;
+constexpr double kHuge = 0x1p100;
+constexpr uint64_t kHugeLimb = uint64_t{1} << 36;
+constexpr Precision kPrecision = 512;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+}  // namespace
+
+class ScalarTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ten_ = MakeNumber({kTen});
+    long_ = MakeNumber({kLarge, kMax, kSeven, kLarge}, -2);
+  }
+
+  BigFloat ten_, long_;
+};
+
+TEST_F(ScalarTest, AddsIntegers) {
+  EXPECT_TRUE(IsEqual(Add(ten_, kThree), MakeNumber({kTen + kThree})));
+  EXPECT_TRUE(IsEqual(Add(ten_, kMinusThree), MakeNumber({kSeven})));
+  EXPECT_TRUE(IsEqual(Sub(ten_, kThree), MakeNumber({kSeven})));
+  EXPECT_TRUE(IsEqual(Sub(ten_, kMinusThree), MakeNumber({kTen + kThree})));
+  EXPECT_TRUE(IsZero(Sub(ten_, kTen)));
+}
+
+TEST_F(ScalarTest, AcceptsPlainIntegerLiterals) {
+  EXPECT_TRUE(IsEqual(Add(ten_, 1), Add(ten_, kOne)));
+  EXPECT_TRUE(IsEqual(Sub(ten_, -3), Sub(ten_, kMinusThree)));
+  EXPECT_TRUE(IsEqual(Mul(ten_, 2), Mul(ten_, kTwo)));
+  EXPECT_TRUE(IsEqual(Mul(ten_, 2U), Mul(ten_, kTwo)));
+  EXPECT_TRUE(IsEqual(Div(ten_, 5), Div(ten_, kFive)));
+  EXPECT_TRUE(IsEqual(Div(long_, -2LL, kPrecision),
+                      Div(long_, kMinusTwo, kPrecision)));
+}
+
+TEST_F(ScalarTest, AddsDoubles) {
+  EXPECT_TRUE(IsEqual(Add(ten_, kQuarter), MakeNumber({kHalf >> 1, kTen}, -1)));
+  EXPECT_TRUE(IsEqual(Sub(ten_, -kHuge), MakeNumber({kTen, kHugeLimb})));
+  EXPECT_TRUE(IsInf(Add(ten_, HUGE_VAL)));
+  EXPECT_TRUE(IsNan(Add(ten_, std::nan(""))));
+}
+
+TEST_F(ScalarTest, MultipliesByLimb) {
+  EXPECT_TRUE(IsEqual(Mul(long_, kSeven), Mul(long_, MakeNumber({kSeven}))));
+  EXPECT_TRUE(
+      IsEqual(Mul(ten_, kMinusTwo), MakeNumber({kTen * kTwo}, 0, true)));
+  EXPECT_TRUE(IsEqual(Mul(ten_, kOneAndHalf), MakeNumber({kFive * kThree})));
+  EXPECT_TRUE(IsZero(Mul(long_, uint64_t{0})));
+  EXPECT_TRUE(IsNan(Mul(MakeInf(), uint64_t{0})));
+}
+
+TEST_F(ScalarTest, DividesByLimb) {
+  for (const uint64_t kDivisor : {kThree, kSeven, kHalf + 1, kLarge, kMax}) {
+    EXPECT_TRUE(IsEqual(Div(long_, kDivisor, kPrecision),
+                        Div(long_, MakeNumber({kDivisor}), kPrecision)));
+  }
+  EXPECT_TRUE(IsEqual(Div(ten_, kFive), MakeNumber({kTwo})));
+  EXPECT_TRUE(IsEqual(Div(ten_, kMinusTwo), MakeNumber({kFive}, 0, true)));
+  EXPECT_TRUE(IsEqual(Div(ten_, kQuarter), MakeNumber({kTen << kTwo})));
+}
+
+TEST_F(ScalarTest, DivisionByZero) {
+  const BigFloat kResult = Div(ten_, -0.0);
+
+  EXPECT_TRUE(IsInf(kResult));
+  EXPECT_TRUE(IsNegative(GetSign(kResult)));
+  EXPECT_TRUE(IsNan(Div(MakeNan(), kThree)));
+  EXPECT_TRUE(IsInf(Div(ten_, uint64_t{0})));
+}
@@ -0,0 +1,163 @@
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_float_view.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "shared.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Constant;
+using big_float::Exponent;
+using big_float::GetConstant;
+using big_float::GetDefaultError;
+using big_float::GetMutableMantissa;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::GetSharedConstant;
+using big_float::IsEqual;
+using big_float::IsNan;
+using big_float::MakeBigFloat;
+using big_float::MakeNan;
+using big_float::MakeView;
+using big_float::Neg;
+using big_float::Precision;
+using big_float::Share;
+using big_float::SharedBigFloat;
+using big_float::Sign;
+using big_float::ToBigFloat;
+using big_float::Truncate;
+using big_float::Type;
+using big_float::Unshare;
+
+namespace {
+
+constexpr uint64_t kFirst = 7;
+constexpr uint64_t kSecond = 11;
+constexpr uint64_t kThird = 13;
+constexpr Exponent kExponent = -2;
+constexpr Precision kPrecision = 200;
+constexpr int kThreadCount = 4;
+
+static_assert(
+    std::is_const_v<decltype(SharedBigFloat::mantissa)::element_type>);
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+}  // namespace
+
+class SharedTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    number_ = MakeNumber({kFirst, kSecond, kThird}, kExponent);
+  }
+
+  BigFloat number_;
+};
+
+TEST_F(SharedTest, CopiesShareLimbs) {
+  SharedBigFloat shared = Share(number_);
+  SharedBigFloat copy = shared;
+
+  EXPECT_EQ(copy.mantissa.get(), shared.mantissa.get());
+  EXPECT_TRUE(IsEqual(MakeView(copy), MakeView(number_)));
+}
+
+TEST_F(SharedTest, NegSharesLimbs) {
+  SharedBigFloat shared = Share(number_);
+
+  SharedBigFloat negated = Neg(shared);
+
+  EXPECT_EQ(negated.mantissa.get(), shared.mantissa.get());
+  EXPECT_TRUE(IsEqual(MakeView(negated), MakeView(Neg(number_))));
+  EXPECT_TRUE(IsEqual(MakeView(shared), MakeView(number_)));
+}
+
+TEST_F(SharedTest, MutationCopiesSharedLimbs) {
+  SharedBigFloat shared = Share(number_);
+  SharedBigFloat copy = shared;
+
+  GetMutableMantissa(copy).limbs.front() = kSecond;
+
+  EXPECT_NE(copy.mantissa.get(), shared.mantissa.get());
+  EXPECT_TRUE(IsEqual(MakeView(shared), MakeView(number_)));
+  EXPECT_TRUE(IsEqual(MakeView(copy),
+                      MakeView(MakeNumber({kSecond, kSecond, kThird},
+                                          kExponent))));
+}
+
+TEST_F(SharedTest, UnshareMovesUniqueLimbs) {
+  SharedBigFloat shared = Share(number_);
+  const uint64_t* limbs = shared.mantissa->limbs.data();
+
+  BigFloat result = Unshare(std::move(shared));
+
+  EXPECT_EQ(result.number.limbs.data(), limbs);
+  EXPECT_TRUE(IsEqual(result, number_));
+}
+
+TEST_F(SharedTest, SpecialValuesHaveNoMantissa) {
+  SharedBigFloat shared = Share(MakeNan());
+
+  EXPECT_EQ(shared.mantissa, nullptr);
+  EXPECT_TRUE(IsNan(Unshare(shared)));
+  EXPECT_TRUE(IsNan(ToBigFloat(MakeView(shared))));
+}
+
+TEST_F(SharedTest, ArithmeticOnViews) {
+  SharedBigFloat shared = Share(number_);
+
+  BigFloat result = Add(MakeView(shared), MakeView(Neg(shared)));
+
+  EXPECT_TRUE(IsEqual(result, Add(number_, Neg(number_))));
+}
+
+TEST_F(SharedTest, ConstantHandleIsShared) {
+  SharedBigFloat first = GetSharedConstant(Constant::kPi, kPrecision);
+  SharedBigFloat second = GetSharedConstant(Constant::kPi, kPrecision);
+
+  EXPECT_EQ(first.mantissa.get(), second.mantissa.get());
+  EXPECT_TRUE(IsEqual(Truncate(MakeView(first), kPrecision),
+                      GetConstant(Constant::kPi, kPrecision)));
+}
+
+TEST_F(SharedTest, HandlesAreSharedAcrossThreads) {
+  const SharedBigFloat kShared = Share(number_);
+  std::vector<std::thread> threads;
+  std::vector<int> matches(kThreadCount, 0);
+  for (int index = 0; index < kThreadCount; ++index) {
+    threads.emplace_back([&, index] {
+      SharedBigFloat copy = kShared;
+      GetMutableMantissa(copy).limbs.back() = kFirst;
+      matches[static_cast<size_t>(index)] =
+          IsEqual(MakeView(kShared), MakeView(number_)) ? 1 : 0;
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (int match : matches) {
+    EXPECT_EQ(match, 1);
+  }
+}
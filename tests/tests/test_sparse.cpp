@@ -0,0 +1,153 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "sparse.hpp"
+#include "type.hpp"
+
+using big_float::Add;
+using big_float::BigFloat;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsGreater;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeSparse;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::Neg;
+using big_float::Sign;
+using big_float::SparseBigFloat;
+using big_float::Sub;
+using big_float::ToBigFloat;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kOne = 1;
+constexpr uint64_t kTwo = 2;
+constexpr uint64_t kSeven = 7;
+constexpr uint64_t kAllOnes = std::numeric_limits<uint64_t>::max();
+constexpr Exponent kFarExponent = 1000000;
+constexpr size_t kGap = 10;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+// low + high * B^(gap + 1) as dense limbs.
+std::vector<uint64_t>
+MakeGapped(uint64_t low, uint64_t high) {
+  std::vector<uint64_t> limbs(kGap + 2, 0);
+  limbs.front() = low;
+  limbs.back() = high;
+  return limbs;
+}
+
+}  // namespace
+
+class SparseTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    far_ = {.runs = {{.exp = 0, .limbs = {kOne}},
+                     {.exp = kFarExponent, .limbs = {kOne}}},
+            .type = Type::kDefault,
+            .sign = GetPositive(),
+            .error = GetDefaultError()};
+    one_ = MakeSparse(MakeNumber({kOne}));
+  }
+
+  SparseBigFloat far_, one_;
+};
+
+TEST_F(SparseTest, SplitsAtZeroRuns) {
+  const BigFloat kDense = MakeNumber(MakeGapped(kSeven, kTwo), -1);
+  const SparseBigFloat kSparse = MakeSparse(kDense);
+
+  ASSERT_EQ(kSparse.runs.size(), 2);
+  EXPECT_EQ(kSparse.runs[1].exp, static_cast<Exponent>(kGap));
+  EXPECT_TRUE(IsEqual(ToBigFloat(kSparse), kDense));
+}
+
+TEST_F(SparseTest, AddKeepsGaps) {
+  const SparseBigFloat kSum = Add(far_, far_);
+
+  ASSERT_EQ(kSum.runs.size(), 2);
+  EXPECT_EQ(kSum.runs[0].limbs, std::vector<uint64_t>{kTwo});
+  EXPECT_EQ(kSum.runs[1].exp, kFarExponent);
+  EXPECT_EQ(kSum.runs[1].limbs, std::vector<uint64_t>{kTwo});
+
+  const SparseBigFloat kDifference = Sub(kSum, far_);
+
+  EXPECT_TRUE(IsEqual(kDifference, far_));
+  EXPECT_TRUE(IsZero(ToBigFloat(Sub(far_, far_))));
+}
+
+TEST_F(SparseTest, MatchesDenseArithmetic) {
+  const BigFloat kLhs = MakeNumber(MakeGapped(kAllOnes, kSeven));
+  const BigFloat kRhs = MakeNumber(MakeGapped(kTwo, kOne), 1, true);
+  const SparseBigFloat kSparseLhs = MakeSparse(kLhs);
+  const SparseBigFloat kSparseRhs = MakeSparse(kRhs);
+
+  EXPECT_TRUE(
+      IsEqual(ToBigFloat(Add(kSparseLhs, kSparseRhs)), Add(kLhs, kRhs)));
+  EXPECT_TRUE(
+      IsEqual(ToBigFloat(Sub(kSparseLhs, kSparseRhs)), Sub(kLhs, kRhs)));
+  EXPECT_TRUE(
+      IsEqual(ToBigFloat(Sub(kSparseRhs, kSparseLhs)), Sub(kRhs, kLhs)));
+  EXPECT_TRUE(
+      IsEqual(ToBigFloat(Mul(kSparseLhs, kSparseRhs)), Mul(kLhs, kRhs)));
+}
+
+TEST_F(SparseTest, BorrowCrossesGap) {
+  const BigFloat kDense = MakeNumber(MakeGapped(0, kOne));
+  const SparseBigFloat kDifference = Sub(MakeSparse(kDense), one_);
+
+  ASSERT_EQ(kDifference.runs.size(), 1);
+  EXPECT_TRUE(
+      IsEqual(ToBigFloat(kDifference), Sub(kDense, MakeNumber({kOne}))));
+}
+
+TEST_F(SparseTest, ComparesRuns) {
+  const SparseBigFloat kLarger = Add(far_, one_);
+
+  EXPECT_TRUE(IsGreater(kLarger, far_));
+  EXPECT_TRUE(IsLower(far_, kLarger));
+  EXPECT_TRUE(IsGreater(far_, Neg(kLarger)));
+  EXPECT_TRUE(IsLower(one_, far_));
+  EXPECT_FALSE(IsEqual(far_, one_));
+}
+
+TEST_F(SparseTest, SpecialValues) {
+  const SparseBigFloat kInf = MakeSparse(MakeInf(GetNegative()));
+  const SparseBigFloat kZero = MakeSparse(MakeZero());
+
+  EXPECT_TRUE(IsEqual(Add(far_, kZero), far_));
+  EXPECT_TRUE(IsInf(ToBigFloat(Add(far_, kInf))));
+  EXPECT_TRUE(IsNan(ToBigFloat(Sub(kInf, kInf))));
+  EXPECT_TRUE(IsLower(kInf, far_));
+  EXPECT_FALSE(IsEqual(MakeSparse(MakeNan()), far_));
+}
@@ -0,0 +1,130 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Abs;
+using big_float::BigFloat;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sqrt;
+using big_float::Sub;
+using big_float::Type;
+
+namespace {
+
+constexpr uint64_t kTwo = 2;
+constexpr uint64_t kSquare = 1 << 20;
+constexpr uint64_t kRoot = 1 << 10;
+constexpr Exponent kOddExponent = 3;
+constexpr Precision kPrecision = 512;
+constexpr Exponent kTolerance = -7;
+constexpr Precision kLongPrecision = 8192;
+constexpr Exponent kLongTolerance = -126;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+BigFloat
+GetSquareError(const BigFloat& root, const BigFloat& radicand) {
+  return Abs(Sub(Mul(root, root), radicand));
+}
+
+}  // namespace
+
+class SqrtTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pos_zero_ = MakeZero(GetPositive());
+    pos_inf_ = MakeInf(GetPositive());
+    neg_inf_ = MakeInf(GetNegative());
+    pos_nan_ = MakeNan(GetPositive());
+    two_ = MakeNumber({kTwo});
+  }
+
+  BigFloat pos_zero_;
+  BigFloat pos_inf_, neg_inf_;
+  BigFloat pos_nan_;
+  BigFloat two_;
+};
+
+TEST_F(SqrtTest, PerfectSquareIsClose) {
+  BigFloat result = Sqrt(MakeNumber({kSquare}), kPrecision);
+
+  BigFloat error = Abs(Sub(result, MakeNumber({kRoot})));
+
+  EXPECT_TRUE(IsLower(error, MakeNumber({1}, kTolerance)));
+}
+
+TEST_F(SqrtTest, SquareRootOfTwo) {
+  BigFloat result = Sqrt(two_, kPrecision);
+
+  EXPECT_TRUE(IsLower(GetSquareError(result, two_),
+                      MakeNumber({1}, kTolerance)));
+}
+
+TEST_F(SqrtTest, OddExponent) {
+  BigFloat radicand = MakeNumber({kTwo}, kOddExponent);
+
+  BigFloat result = Sqrt(radicand, kPrecision);
+  BigFloat tolerance = MakeNumber({1}, kTolerance + kOddExponent);
+
+  EXPECT_TRUE(IsLower(GetSquareError(result, radicand), tolerance));
+}
+
+TEST_F(SqrtTest, SmallRadicand) {
+  BigFloat radicand = MakeNumber({kTwo}, -kOddExponent);
+
+  BigFloat result = Sqrt(radicand, kPrecision);
+  BigFloat tolerance = MakeNumber({1}, kTolerance - kOddExponent);
+
+  EXPECT_TRUE(IsLower(GetSquareError(result, radicand), tolerance));
+}
+
+TEST_F(SqrtTest, HighPrecision) {
+  BigFloat result = Sqrt(two_, kLongPrecision);
+
+  EXPECT_TRUE(IsLower(GetSquareError(result, two_),
+                      MakeNumber({1}, kLongTolerance)));
+}
+
+TEST_F(SqrtTest, SpecialValues) {
+  EXPECT_TRUE(IsZero(Sqrt(pos_zero_)));
+  EXPECT_TRUE(IsEqual(Sqrt(pos_inf_), pos_inf_));
+  EXPECT_TRUE(IsNan(Sqrt(neg_inf_)));
+  EXPECT_TRUE(IsNan(Sqrt(pos_nan_)));
+}
+
+TEST_F(SqrtTest, NegativeIsNan) {
+  EXPECT_TRUE(IsNan(Sqrt(MakeNumber({kTwo}, 0, true))));
+}
@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "sign.hpp"
+#include "stream.hpp"
+#include "type.hpp"
+
+using big_float::BigFloat;
+using big_float::ErrorCode;
+using big_float::Exponent;
+using big_float::FinishStream;
+using big_float::FlushStream;
+using big_float::GetDefaultError;
+using big_float::GetError;
+using big_float::GetErrorCode;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::IsEqual;
+using big_float::IsInf;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsOk;
+using big_float::MakeBigFloat;
+using big_float::MakeError;
+using big_float::MakeInf;
+using big_float::MakeStreamReader;
+using big_float::MakeStreamWriter;
+using big_float::MakeZero;
+using big_float::ReadChunk;
+using big_float::ReadStream;
+using big_float::Sign;
+using big_float::StreamReader;
+using big_float::StreamWriter;
+using big_float::Type;
+using big_float::WriteLimbs;
+using big_float::WriteStream;
+
+namespace {
+
+constexpr size_t kChunkLimbs = 4;
+constexpr size_t kManyLimbs = 37;
+constexpr size_t kPieceLimbs = 3;
+constexpr Exponent kExponent = -5;
+constexpr uint64_t kSmallNumber = 42;
+constexpr off_t kCorruptOffset = 48;
+constexpr uint8_t kUnknownErrorCode = 0x7F;
+
+std::vector<uint64_t>
+MakeLimbs(size_t count) {
+  std::vector<uint64_t> limbs(count);
+  for (size_t index = 0; index < count; ++index) {
+    limbs[index] = (index + 1) * 0x9E3779B97F4A7C15;
+  }
+  return limbs;
+}
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+}  // namespace
+
+class StreamTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    file_ = std::tmpfile();
+    ASSERT_NE(file_, nullptr);
+    descriptor_ = fileno(file_);
+  }
+
+  void TearDown() override { std::fclose(file_); }
+
+  void Rewind() const { ::lseek(descriptor_, 0, SEEK_SET); }
+
+  std::FILE* file_ = nullptr;
+  int descriptor_ = -1;
+};
+
+TEST_F(StreamTest, RoundTripSingleChunk) {
+  BigFloat number = MakeNumber({kSmallNumber}, kExponent, true);
+
+  ASSERT_TRUE(IsOk(WriteStream(descriptor_, number)));
+  Rewind();
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_TRUE(IsEqual(result, number));
+}
+
+TEST_F(StreamTest, RoundTripManyChunks) {
+  BigFloat number = MakeNumber(MakeLimbs(kManyLimbs), kExponent);
+
+  ASSERT_TRUE(IsOk(WriteStream(descriptor_, number, kChunkLimbs)));
+  Rewind();
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_TRUE(IsEqual(result, number));
+}
+
+TEST_F(StreamTest, IncrementalWritesWithFlush) {
+  std::vector<uint64_t> limbs = MakeLimbs(kManyLimbs);
+  StreamWriter writer = MakeStreamWriter(descriptor_, kChunkLimbs);
+
+  std::span<const uint64_t> rest(limbs);
+  while (!rest.empty()) {
+    const size_t kTaken = std::min(kPieceLimbs, rest.size());
+    ASSERT_TRUE(IsOk(WriteLimbs(writer, rest.first(kTaken))));
+    rest = rest.subspan(kTaken);
+    if (rest.size() == kManyLimbs / 2) {
+      ASSERT_TRUE(IsOk(FlushStream(writer)));
+    }
+  }
+  ASSERT_TRUE(IsOk(FinishStream(writer, kExponent, GetPositive(),
+                                Type::kDefault, GetDefaultError())));
+  Rewind();
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_TRUE(IsEqual(result, MakeNumber(limbs, kExponent)));
+}
+
+TEST_F(StreamTest, ChunksRespectChunkSize) {
+  BigFloat number = MakeNumber(MakeLimbs(kManyLimbs));
+  ASSERT_TRUE(IsOk(WriteStream(descriptor_, number, kChunkLimbs)));
+  Rewind();
+
+  StreamReader reader = MakeStreamReader(descriptor_);
+  size_t total = 0;
+  for (auto chunk = ReadChunk(reader); !chunk.empty();
+       chunk = ReadChunk(reader)) {
+    EXPECT_LE(chunk.size(), kChunkLimbs);
+    total += chunk.size();
+  }
+
+  EXPECT_TRUE(IsOk(reader.error));
+  EXPECT_TRUE(reader.is_finished);
+  EXPECT_EQ(total, kManyLimbs);
+}
+
+TEST_F(StreamTest, SpecialValues) {
+  ASSERT_TRUE(IsOk(WriteStream(descriptor_, MakeInf(GetNegative()))));
+  Rewind();
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_TRUE(IsInf(result));
+  EXPECT_TRUE(IsLower(result, MakeZero()));
+}
+
+TEST_F(StreamTest, CorruptedLimbIsDetected) {
+  BigFloat number = MakeNumber(MakeLimbs(kManyLimbs));
+  ASSERT_TRUE(IsOk(WriteStream(descriptor_, number, kChunkLimbs)));
+  const char kGarbage = 'x';
+  ASSERT_EQ(::pwrite(descriptor_, &kGarbage, 1, kCorruptOffset), 1);
+  Rewind();
+
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_TRUE(IsNan(result));
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kChecksumMismatch);
+}
+
+TEST_F(StreamTest, TruncatedStreamIsIoError) {
+  BigFloat number = MakeNumber(MakeLimbs(kManyLimbs));
+  ASSERT_TRUE(IsOk(WriteStream(descriptor_, number, kChunkLimbs)));
+  ASSERT_EQ(::ftruncate(descriptor_, kCorruptOffset), 0);
+  Rewind();
+
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kIoError);
+}
+
+TEST_F(StreamTest, UnknownErrorCodeIsInvalidFormat) {
+  const std::vector<uint64_t> kLimbs = MakeLimbs(kChunkLimbs);
+  StreamWriter writer = MakeStreamWriter(descriptor_, kChunkLimbs);
+  ASSERT_TRUE(IsOk(WriteLimbs(writer, kLimbs)));
+  ASSERT_TRUE(IsOk(
+      FinishStream(writer, kExponent, GetPositive(), Type::kDefault,
+                   MakeError(static_cast<ErrorCode>(kUnknownErrorCode)))));
+  Rewind();
+
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_TRUE(IsNan(result));
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kInvalidFormat);
+}
+
+TEST_F(StreamTest, ForeignDataIsInvalidFormat) {
+  const std::vector<uint64_t> kGarbage = MakeLimbs(kChunkLimbs);
+  ASSERT_TRUE(::write(descriptor_, kGarbage.data(),
+                      kGarbage.size() * sizeof(uint64_t)) > 0);
+  Rewind();
+
+  BigFloat result = ReadStream(descriptor_);
+
+  EXPECT_EQ(GetErrorCode(GetError(result)), ErrorCode::kInvalidFormat);
+}
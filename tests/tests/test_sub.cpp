@@ -1,3 +1,7 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "big_float.hpp"
@@ -7,6 +11,7 @@
 #include "sign.hpp"
 #include "type.hpp"
 
+using big_float::Add;
 using big_float::BigFloat;
 using big_float::Exponent;
 using big_float::GetDefaultError;
@@ -40,6 +45,16 @@ MakeNumber(uint64_t value, Exponent exp = 0, bool negative = false) {
   return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
 }
 
+BigFloat
+MakeLimbs(std::vector<uint64_t> limbs, Exponent exp = 0,
+          bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
 }  // namespace
 
 class SubTest : public ::testing::Test {
@@ -399,3 +414,55 @@ TEST_F(SubTest, ZeroProperty) {
   // Assert
   EXPECT_TRUE(IsEqual(result, pos_zero_));
 }
+
+TEST_F(SubTest, SmallerExponentLargerMagnitude) {
+  // Arrange - 1 * 2^64 + 0 is larger than 2^64 - 1 stored one limb lower
+  BigFloat left = MakeNumber(1, 1);
+  BigFloat right = MakeNumber(UINT64_MAX);
+
+  // Act
+  BigFloat result = Sub(left, right);
+
+  // Assert
+  EXPECT_TRUE(IsEqual(result, MakeNumber(1)));
+}
+
+TEST_F(SubTest, EqualTopLimbsCancel) {
+  // Arrange
+  BigFloat left = MakeLimbs({kLargeNumber, kTestNumber, kTestNumber});
+  BigFloat right = MakeLimbs({kSmallNumber, kTestNumber, kTestNumber});
+
+  // Act
+  BigFloat result = Sub(left, right);
+  BigFloat reversed = Sub(right, left);
+
+  // Assert
+  EXPECT_TRUE(IsEqual(result, MakeNumber(kLargeNumber - kSmallNumber)));
+  EXPECT_TRUE(
+      IsEqual(reversed, MakeNumber(kLargeNumber - kSmallNumber, 0, true)));
+}
+
+TEST_F(SubTest, DifferenceBelowShiftedOperand) {
+  // Arrange - the operands agree on every limb the shorter one covers
+  BigFloat left = MakeLimbs({1, kTestNumber}, -1);
+  BigFloat right = MakeNumber(kTestNumber);
+
+  // Act
+  BigFloat result = Sub(right, left);
+
+  // Assert
+  EXPECT_TRUE(IsEqual(result, MakeNumber(1, -1, true)));
+}
+
+TEST_F(SubTest, MixedSignAddSharesKernel) {
+  // Arrange
+  BigFloat left = MakeLimbs({0, kTestNumber}, kSmallExponent);
+  BigFloat right = MakeNumber(1, kSmallExponent, true);
+
+  // Act
+  BigFloat result = Add(left, right);
+
+  // Assert
+  EXPECT_TRUE(IsEqual(
+      result, MakeLimbs({UINT64_MAX, kTestNumber - 1}, kSmallExponent)));
+}
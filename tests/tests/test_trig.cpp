@@ -0,0 +1,205 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_float.hpp"
+#include "big_uint.hpp"
+#include "constants.hpp"
+#include "elementary.hpp"
+#include "error.hpp"
+#include "exponent.hpp"
+#include "precision.hpp"
+#include "sign.hpp"
+#include "type.hpp"
+
+using big_float::Abs;
+using big_float::Add;
+using big_float::Atan;
+using big_float::Atan2;
+using big_float::BigFloat;
+using big_float::ComputePi;
+using big_float::Cos;
+using big_float::Exponent;
+using big_float::GetDefaultError;
+using big_float::GetNegative;
+using big_float::GetPositive;
+using big_float::GetSign;
+using big_float::IsEqual;
+using big_float::IsLower;
+using big_float::IsNan;
+using big_float::IsNegative;
+using big_float::IsZero;
+using big_float::MakeBigFloat;
+using big_float::MakeInf;
+using big_float::MakeNan;
+using big_float::MakeZero;
+using big_float::Mul;
+using big_float::Neg;
+using big_float::Precision;
+using big_float::Sign;
+using big_float::Sin;
+using big_float::SinCos;
+using big_float::SineCosine;
+using big_float::Sub;
+using big_float::Tan;
+using big_float::Type;
+
+namespace {
+
+// sin(1) and cos(1) with 256 fractional bits, least significant limb first.
+const std::vector<uint64_t> kSinOneLimbs = {
+    0xEFB6CA5FD6C649BD, 0x89E511132F518B4D, 0xC6E9E909C50F3C32,
+    0xD76AA47848677020};
+const std::vector<uint64_t> kCosOneLimbs = {
+    0xF2300240B760E6FA, 0xA2373A894F96C3B7, 0xC2466D976871BD29,
+    0x8A51407DA8345C91};
+constexpr Exponent kReferenceExponent = -4;
+constexpr uint64_t kReferenceTolerance = 8;
+
+// 6381956970095103 * 2^797 lies within 2^-61 of a multiple of pi / 2.
+const std::vector<uint64_t> kHardAngleLimbs = {0x64C5943FE0000000,
+                                               0x000000000002D58B};
+constexpr Exponent kHardAngleExponent = 12;
+const std::vector<uint64_t> kHardCosineLimbs = {
+    0xAA930BC1E8716D10, 0xF0D77D517C56802B, 0x443AE209BC758290,
+    0xA5739735D1177A30, 0x0000000000000008};
+constexpr Exponent kHardCosineExponent = -5;
+constexpr Exponent kHardTolerance = -8;
+
+constexpr Precision kPrecision = 256;
+constexpr Precision kHighPrecision = 3000;
+constexpr Exponent kHighTolerance = -45;
+constexpr uint64_t kThree = 3;
+constexpr uint64_t kSeven = 7;
+
+BigFloat
+MakeNumber(std::vector<uint64_t> limbs, Exponent exp = 0,
+           bool negative = false) {
+  big_uint::BigUInt mantissa;
+  mantissa.limbs = std::move(limbs);
+
+  Sign sign = negative ? GetNegative() : GetPositive();
+  return MakeBigFloat(mantissa, exp, sign, Type::kDefault, GetDefaultError());
+}
+
+bool
+IsClose(const BigFloat& value, const BigFloat& expected,
+        const BigFloat& tolerance) {
+  return IsLower(Abs(Sub(value, expected)), tolerance);
+}
+
+}  // namespace
+
+class TrigTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pos_zero_ = MakeZero(GetPositive());
+    neg_zero_ = MakeZero(GetNegative());
+    pos_inf_ = MakeInf(GetPositive());
+    pos_nan_ = MakeNan(GetPositive());
+
+    one_ = MakeNumber({1});
+    neg_one_ = MakeNumber({1}, 0, true);
+    pi_ = ComputePi(kPrecision + kPrecision);
+    tolerance_ = MakeNumber({kReferenceTolerance}, kReferenceExponent);
+  }
+
+  BigFloat pos_zero_, neg_zero_;
+  BigFloat pos_inf_;
+  BigFloat pos_nan_;
+  BigFloat one_, neg_one_;
+  BigFloat pi_;
+  BigFloat tolerance_;
+};
+
+TEST_F(TrigTest, SinMatchesReference) {
+  BigFloat result = Sin(one_, kPrecision);
+
+  EXPECT_TRUE(IsClose(result, MakeNumber(kSinOneLimbs, kReferenceExponent),
+                      tolerance_));
+}
+
+TEST_F(TrigTest, CosMatchesReference) {
+  BigFloat result = Cos(neg_one_, kPrecision);
+
+  EXPECT_TRUE(IsClose(result, MakeNumber(kCosOneLimbs, kReferenceExponent),
+                      tolerance_));
+}
+
+TEST_F(TrigTest, SinCosMatchesSeparateCalls) {
+  BigFloat angle = MakeNumber({kSeven});
+
+  SineCosine result = SinCos(angle, kPrecision);
+
+  EXPECT_TRUE(IsEqual(result.sin, Sin(angle, kPrecision)));
+  EXPECT_TRUE(IsEqual(result.cos, Cos(angle, kPrecision)));
+}
+
+TEST_F(TrigTest, PythagoreanIdentityAtHighPrecision) {
+  SineCosine result = SinCos(MakeNumber({kThree}), kHighPrecision);
+
+  BigFloat sum = Add(Mul(result.sin, result.sin), Mul(result.cos, result.cos));
+
+  EXPECT_TRUE(IsClose(sum, one_, MakeNumber({1}, kHighTolerance)));
+}
+
+TEST_F(TrigTest, ReductionNearMultipleOfHalfPi) {
+  BigFloat angle = MakeNumber(kHardAngleLimbs, kHardAngleExponent);
+  BigFloat expected = MakeNumber(kHardCosineLimbs, kHardCosineExponent, true);
+
+  BigFloat result = Cos(angle, kPrecision);
+  BigFloat relative = Abs(Sub(result, expected));
+
+  EXPECT_TRUE(IsNegative(GetSign(result)));
+  EXPECT_TRUE(IsLower(relative, Mul(Abs(expected),
+                                    MakeNumber({1}, kHardTolerance))));
+}
+
+TEST_F(TrigTest, TanInvertsAtan) {
+  BigFloat value = MakeNumber({kSeven}, 0, true);
+
+  BigFloat result = Tan(Atan(value, kPrecision), kPrecision);
+
+  EXPECT_TRUE(IsClose(result, value, MakeNumber({1}, kReferenceExponent + 1)));
+}
+
+TEST_F(TrigTest, AtanOfOneIsQuarterTurn) {
+  BigFloat quarter = Mul(pi_, MakeNumber({uint64_t{1} << 62}, -1));
+
+  EXPECT_TRUE(IsClose(Atan(one_, kPrecision), quarter, tolerance_));
+}
+
+TEST_F(TrigTest, Atan2CoversAllQuadrants) {
+  BigFloat quarter = Mul(pi_, MakeNumber({uint64_t{1} << 62}, -1));
+  BigFloat three_quarters = Mul(quarter, MakeNumber({kThree}));
+
+  EXPECT_TRUE(IsClose(Atan2(one_, one_, kPrecision), quarter, tolerance_));
+  EXPECT_TRUE(
+      IsClose(Atan2(one_, neg_one_, kPrecision), three_quarters, tolerance_));
+  EXPECT_TRUE(IsClose(Atan2(neg_one_, neg_one_, kPrecision),
+                      Neg(three_quarters), tolerance_));
+  EXPECT_TRUE(
+      IsClose(Atan2(neg_one_, one_, kPrecision), Neg(quarter), tolerance_));
+}
+
+TEST_F(TrigTest, Atan2SignedZeros) {
+  EXPECT_TRUE(IsEqual(Atan2(pos_zero_, pos_zero_, kPrecision), pos_zero_));
+  EXPECT_TRUE(IsNegative(GetSign(Atan2(neg_zero_, one_, kPrecision))));
+  EXPECT_TRUE(
+      IsClose(Atan2(pos_zero_, neg_zero_, kPrecision), pi_, tolerance_));
+  EXPECT_TRUE(
+      IsClose(Atan2(neg_zero_, neg_one_, kPrecision), Neg(pi_), tolerance_));
+}
+
+TEST_F(TrigTest, SpecialValues) {
+  EXPECT_TRUE(IsNan(Sin(pos_inf_, kPrecision)));
+  EXPECT_TRUE(IsNan(Cos(pos_nan_, kPrecision)));
+  EXPECT_TRUE(IsNegative(GetSign(Sin(neg_zero_, kPrecision))));
+  EXPECT_TRUE(IsZero(Sin(neg_zero_, kPrecision)));
+  EXPECT_TRUE(IsEqual(Cos(pos_zero_, kPrecision), one_));
+  EXPECT_TRUE(IsClose(Atan(pos_inf_, kPrecision),
+                      Mul(pi_, MakeNumber({uint64_t{1} << 63}, -1)),
+                      tolerance_));
+}